@@ -54,6 +54,11 @@ public:
 
 	bool advertised() const { return _handle != nullptr; }
 
+	/**
+	 * Number of subscribers of the advertised topic instance (0 if not yet advertised).
+	 */
+	int subscriber_count() const { return advertised() ? Manager::orb_get_subscriber_count(_handle) : 0; }
+
 	bool unadvertise() { return (Manager::orb_unadvertise(_handle) == PX4_OK); }
 
 	orb_id_t get_topic() const { return get_orb_meta(_orb_id); }
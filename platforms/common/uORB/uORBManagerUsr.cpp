@@ -324,6 +324,14 @@ uint8_t uORB::Manager::orb_get_instance(const void *node_handle)
 	return data.instance;
 }
 
+int8_t uORB::Manager::orb_get_subscriber_count(const void *node_handle)
+{
+	orbiocdevsubscribercount_t data = {node_handle, 0};
+	boardctl(ORBIOCDEVSUBSCRIBERCOUNT, reinterpret_cast<unsigned long>(&data));
+
+	return data.count;
+}
+
 unsigned uORB::Manager::updates_available(const void *node_handle, unsigned last_generation)
 {
 	orbiocdevupdatesavail_t data = {node_handle, last_generation, 0};
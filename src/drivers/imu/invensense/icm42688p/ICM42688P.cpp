@@ -532,7 +532,10 @@ uint16_t ICM42688P::FIFOReadCount()
 
 bool ICM42688P::FIFORead(const hrt_abstime &timestamp_sample, uint8_t samples)
 {
-	FIFOTransferBuffer buffer{};
+	// preallocated, no need to clear it on every read: after the command byte the bytes clocked out
+	// on MOSI are don't-care for a read burst and are overwritten by the received data
+	FIFOTransferBuffer &buffer = _fifo_buffer;
+	buffer.cmd = static_cast<uint8_t>(Register::BANK_0::INT_STATUS) | DIR_READ;
 	const size_t transfer_size = math::min(samples * sizeof(FIFO::DATA) + 4, FIFO::SIZE);
 	SelectRegisterBank(REG_BANK_SEL_BIT::BANK_SEL_0);
 
@@ -0,0 +1,173 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file AccelCalibrationEstimator.hpp
+ *
+ * Recursive least squares estimator of the residual accelerometer offset and scale factors. It is fed
+ * with the mean specific force of stationary segments, where the magnitude of the correctly calibrated
+ * measurement has to be equal to gravity:
+ *
+ *   f_true = (1 + k) .* (f - o),   |f_true| = g
+ *
+ * The measurement model is linearized around the current estimate at each update (extended RLS), so the
+ * cost of an update is fixed and independent of the number of segments seen so far. Offset and scale are
+ * only observable if the sensor was stationary in several different orientations.
+ */
+
+#pragma once
+
+#include <float.h>
+#include <matrix/matrix/math.hpp>
+
+class AccelCalibrationEstimator
+{
+public:
+	AccelCalibrationEstimator() { reset(); }
+	~AccelCalibrationEstimator() = default;
+
+	static constexpr int NUM_STATES = 6; // scale error (3), offset (3)
+
+	void reset()
+	{
+		_state.setZero();
+		_P.setZero();
+
+		for (int i = 0; i < 3; i++) {
+			_P(i, i) = SCALE_VAR_INIT;
+			_P(3 + i, 3 + i) = OFFSET_VAR_INIT;
+		}
+
+		_update_count = 0;
+	}
+
+	void setGravity(float gravity) { _gravity = gravity; }
+
+	/**
+	 * Set the variance of the specific force magnitude of a stationary segment.
+	 * @param var variance in (m/s^2)^2
+	 */
+	void setMeasurementVariance(float var) { _measurement_var = var; }
+
+	/**
+	 * Update the estimate with a stationary measurement.
+	 * @param specific_force mean accelerometer data of a stationary segment (m/s^2)
+	 * @return true if the measurement was used, false if it was rejected
+	 */
+	bool update(const matrix::Vector3f &specific_force)
+	{
+		const matrix::Vector3f scale = getScale();
+		const matrix::Vector3f unbiased = specific_force - getOffset();
+		const matrix::Vector3f corrected = unbiased.emult(scale);
+		const float corrected_norm = corrected.norm();
+
+		if (!(corrected_norm > FLT_EPSILON)) {
+			return false;
+		}
+
+		const matrix::Vector3f direction = corrected / corrected_norm;
+
+		// Jacobian of |f_true| with respect to the states
+		matrix::Vector<float, NUM_STATES> H;
+
+		for (int i = 0; i < 3; i++) {
+			H(i) = direction(i) * unbiased(i);
+			H(3 + i) = -direction(i) * scale(i);
+		}
+
+		const matrix::Vector<float, NUM_STATES> PHt = _P * H;
+		const float innov_var = H.dot(PHt) + _measurement_var;
+		const float innov = _gravity - corrected_norm;
+
+		if (innov * innov > INNOV_GATE * INNOV_GATE * innov_var) {
+			return false;
+		}
+
+		const matrix::Vector<float, NUM_STATES> K = PHt / innov_var;
+		_state += K * innov;
+
+		// P = (I - K H) P, P is symmetric so H P = (P H)^T
+		for (int i = 0; i < NUM_STATES; i++) {
+			for (int j = 0; j <= i; j++) {
+				_P(i, j) -= 0.5f * (K(i) * PHt(j) + K(j) * PHt(i));
+				_P(j, i) = _P(i, j);
+			}
+		}
+
+		_update_count++;
+		return true;
+	}
+
+	/**
+	 * @return true once the uncertainty of all states dropped below the convergence thresholds
+	 */
+	bool converged() const
+	{
+		if (_update_count < MIN_UPDATES) {
+			return false;
+		}
+
+		for (int i = 0; i < 3; i++) {
+			if ((_P(i, i) > SCALE_VAR_CONVERGED) || (_P(3 + i, 3 + i) > OFFSET_VAR_CONVERGED)) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	matrix::Vector3f getScale() const { return matrix::Vector3f{1.f + _state(0), 1.f + _state(1), 1.f + _state(2)}; }
+	matrix::Vector3f getOffset() const { return matrix::Vector3f{_state(3), _state(4), _state(5)}; }
+
+	matrix::Vector3f getScaleVariance() const { return matrix::Vector3f{_P(0, 0), _P(1, 1), _P(2, 2)}; }
+	matrix::Vector3f getOffsetVariance() const { return matrix::Vector3f{_P(3, 3), _P(4, 4), _P(5, 5)}; }
+
+	unsigned updateCount() const { return _update_count; }
+
+private:
+	static constexpr float SCALE_VAR_INIT = 0.05f * 0.05f;
+	static constexpr float OFFSET_VAR_INIT = 0.5f * 0.5f;
+	static constexpr float SCALE_VAR_CONVERGED = 0.005f * 0.005f;
+	static constexpr float OFFSET_VAR_CONVERGED = 0.05f * 0.05f;
+	static constexpr float INNOV_GATE = 5.f; // innovation consistency gate (SD)
+	static constexpr unsigned MIN_UPDATES = 6;
+
+	matrix::Vector<float, NUM_STATES> _state{};
+	matrix::SquareMatrix<float, NUM_STATES> _P{};
+
+	float _gravity{9.80665f};
+	float _measurement_var{0.02f * 0.02f};
+
+	unsigned _update_count{0};
+};
@@ -0,0 +1,112 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * Test code for the accelerometer calibration estimator
+ * Run this test only using make tests TESTFILTER=AccelCalibrationEstimator
+ */
+
+#include <gtest/gtest.h>
+#include <AccelCalibrationEstimator.hpp>
+
+using namespace matrix;
+
+static constexpr float GRAVITY = 9.80665f;
+
+// accelerometer with offset and scale errors, measuring gravity in the given orientation
+static Vector3f simulateStationary(const Eulerf &attitude, const Vector3f &offset, const Vector3f &scale)
+{
+	const Vector3f specific_force = Dcmf(attitude).transpose() * Vector3f(0.f, 0.f, -GRAVITY);
+	return specific_force.edivide(scale) + offset;
+}
+
+TEST(AccelCalibrationEstimatorTest, sixOrientations)
+{
+	AccelCalibrationEstimator estimator;
+	const Vector3f offset(0.15f, -0.2f, 0.3f);
+	const Vector3f scale(1.02f, 0.98f, 1.01f);
+
+	const Eulerf orientations[] {
+		{0.f, 0.f, 0.f},
+		{M_PI_F, 0.f, 0.f},
+		{M_PI_2_F, 0.f, 0.f},
+		{-M_PI_2_F, 0.f, 0.f},
+		{0.f, M_PI_2_F, 0.f},
+		{0.f, -M_PI_2_F, 0.f},
+		{0.5f, 0.3f, 0.f},
+		{-0.4f, 2.f, 0.f},
+	};
+
+	// a few passes over all orientations, as the model is linearized around the current estimate
+	for (int pass = 0; pass < 3; pass++) {
+		for (const Eulerf &orientation : orientations) {
+			EXPECT_TRUE(estimator.update(simulateStationary(orientation, offset, scale)));
+		}
+	}
+
+	EXPECT_TRUE(estimator.converged());
+
+	const Vector3f offset_est = estimator.getOffset();
+	const Vector3f scale_est = estimator.getScale();
+
+	for (int i = 0; i < 3; i++) {
+		EXPECT_NEAR(offset_est(i), offset(i), 0.02f) << "axis " << i;
+		EXPECT_NEAR(scale_est(i), scale(i), 0.002f) << "axis " << i;
+	}
+}
+
+TEST(AccelCalibrationEstimatorTest, singleOrientationNotConverged)
+{
+	// sitting level on the ground, only the z axis is observed
+	AccelCalibrationEstimator estimator;
+	const Vector3f offset(0.1f, 0.1f, 0.1f);
+	const Vector3f scale(1.f, 1.f, 1.f);
+
+	for (int i = 0; i < 100; i++) {
+		estimator.update(simulateStationary(Eulerf(0.f, 0.f, 0.f), offset, scale));
+	}
+
+	EXPECT_FALSE(estimator.converged());
+	EXPECT_TRUE(estimator.getOffset().isAllFinite());
+	EXPECT_TRUE(estimator.getScale().isAllFinite());
+}
+
+TEST(AccelCalibrationEstimatorTest, rejectOutlier)
+{
+	AccelCalibrationEstimator estimator;
+
+	// vehicle is not actually stationary
+	EXPECT_FALSE(estimator.update(Vector3f(0.f, 0.f, -2.f * GRAVITY)));
+	EXPECT_EQ(estimator.updateCount(), 0u);
+}
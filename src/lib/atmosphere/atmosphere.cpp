@@ -52,6 +52,52 @@ float getPressureFromAltitude(const float altitude_m)
 	return kPressRefSeaLevelPa * powf((altitude_m * kTempGradient + kTempRefKelvin) / kTempRefKelvin,
 					  -CONSTANTS_ONE_G / (kTempGradient * kAirGasConstant));
 }
+
+// exponent of the pressure ratio in the hypsometric equation
+static constexpr float kPressureRatioExponent = -(kTempGradient * kAirGasConstant) / CONSTANTS_ONE_G;
+
+// pressure_ratio^kPressureRatioExponent at pressure ratios 0.1875 + i / 64 (~12400 m to -1400 m in the standard atmosphere)
+// generated with: [(0.1875 + i / 64) ** 0.19029434 for i in range(65)]
+static constexpr float kPressureRatioTableMin = 0.1875f;
+static constexpr float kPressureRatioTableStepInv = 64.f;
+static constexpr int kPressureRatioTableSize = 65;
+static constexpr float kPressureRatioTable[kPressureRatioTableSize] {
+	0.727203996f, 0.738365317f, 0.748851755f, 0.758748217f, 0.768124100f, 0.777036893f,
+	0.785534795f, 0.793658636f, 0.801443329f, 0.808918973f, 0.816111715f, 0.823044418f,
+	0.829737199f, 0.836207859f, 0.842472228f, 0.848544449f, 0.854437216f, 0.860161967f,
+	0.865729045f, 0.871147838f, 0.876426893f, 0.881574018f, 0.886596359f, 0.891500484f,
+	0.896292435f, 0.900977791f, 0.905561710f, 0.910048971f, 0.914444017f, 0.918750976f,
+	0.922973700f, 0.927115785f, 0.931180593f, 0.935171274f, 0.939090783f, 0.942941896f,
+	0.946727223f, 0.950449226f, 0.954110224f, 0.957712407f, 0.961257846f, 0.964748501f,
+	0.968186229f, 0.971572790f, 0.974909855f, 0.978199014f, 0.981441776f, 0.984639579f,
+	0.987793792f, 0.990905723f, 0.993976616f, 0.997007663f, 1.000000000f, 1.002954716f,
+	1.005872850f, 1.008755402f, 1.011603325f, 1.014417536f, 1.017198914f, 1.019948303f,
+	1.022666513f, 1.025354325f, 1.028012488f, 1.030641722f, 1.033242723f,
+};
+
+static float powPressureRatio(const float pressure_ratio)
+{
+	const float index_f = (pressure_ratio - kPressureRatioTableMin) * kPressureRatioTableStepInv;
+
+	if (!(index_f >= 0.f) || (index_f > kPressureRatioTableSize - 1)) {
+		// outside of the table (or NAN)
+		return powf(pressure_ratio, kPressureRatioExponent);
+	}
+
+	// third order expansion around the nearest table entry, relative error below 1e-7
+	//  (r_i * (1 + d))^n = r_i^n * (1 + n d + n (n - 1) / 2 d^2 + n (n - 1) (n - 2) / 6 d^3 + ...)
+	static constexpr float c1 = kPressureRatioExponent;
+	static constexpr float c2 = c1 * (kPressureRatioExponent - 1.f) / 2.f;
+	static constexpr float c3 = c2 * (kPressureRatioExponent - 2.f) / 3.f;
+
+	const int index = static_cast<int>(index_f + 0.5f);
+	const float ratio_index = kPressureRatioTableMin + index / kPressureRatioTableStepInv;
+	const float d = (pressure_ratio - ratio_index) / ratio_index;
+
+	return kPressureRatioTable[index] * (1.f + d * (c1 + d * (c2 + d * c3)));
+}
+
+
 float getAltitudeFromPressure(float pressure_pa, float pressure_sealevel_pa)
 {
 	// calculate altitude using the hypsometric equation
@@ -67,8 +113,7 @@ float getAltitudeFromPressure(float pressure_pa, float pressure_sealevel_pa)
 	 * h = -------------------------------  + h1
 	 *                   a
 	 */
-	return (((powf(pressure_ratio, (-(kTempGradient * kAirGasConstant) / CONSTANTS_ONE_G))) * kTempRefKelvin) -
-		kTempRefKelvin) / kTempGradient;
+	return ((powPressureRatio(pressure_ratio) * kTempRefKelvin) - kTempRefKelvin) / kTempGradient;
 
 }
 float getStandardTemperatureAtAltitude(float altitude_m)
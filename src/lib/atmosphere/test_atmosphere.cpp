@@ -37,6 +37,8 @@
 
 #include <gtest/gtest.h>
 #include <lib/atmosphere/atmosphere.h>
+
+#include <cmath>
 using namespace atmosphere;
 
 TEST(TestAtmosphere, pressureFromAltitude)
@@ -124,3 +126,35 @@ TEST(TestAtmosphere, StandardTemperature)
 	// THEN expect standard temperature at 3000m
 	EXPECT_NEAR(temperature, -4.5f, 0.001f);
 }
+
+TEST(TestAtmosphere, altitudeFromPressureLookup)
+{
+	// GIVEN the hypsometric equation evaluated in double precision
+	const double exponent = -(static_cast<double>(kTempGradient) * static_cast<double>(kAirGasConstant)) / 9.80665;
+	const double temp_ref = static_cast<double>(kTempRefKelvin);
+	const float pressure_sealevel = 101325.f;
+
+	float error_max = 0.f;
+
+	// WHEN we calculate the altitude over the whole table range, and beyond
+	for (float pressure = 15000.f; pressure < 125000.f; pressure += 3.7f) {
+		const double reference = (pow(static_cast<double>(pressure) / static_cast<double>(pressure_sealevel), exponent) * temp_ref
+					  - temp_ref) / static_cast<double>(kTempGradient);
+		const float altitude = getAltitudeFromPressure(pressure, pressure_sealevel);
+
+		error_max = fmaxf(error_max, fabsf(altitude - static_cast<float>(reference)));
+	}
+
+	// THEN expect the error to be in the order of the float resolution (powf: ~5 mm)
+	EXPECT_LT(error_max, 0.02f);
+
+	// AND expect the altitude to be continuous at the table boundaries
+	for (float pressure_ratio : {0.1875f, 0.5f, 1.f, 1.1875f}) {
+		const float pressure = pressure_ratio * pressure_sealevel;
+		EXPECT_NEAR(getAltitudeFromPressure(pressure - 0.01f, pressure_sealevel),
+			    getAltitudeFromPressure(pressure + 0.01f, pressure_sealevel), 0.01f);
+	}
+
+	// AND expect a non-finite pressure not to produce a finite altitude
+	EXPECT_FALSE(std::isfinite(getAltitudeFromPressure(NAN, pressure_sealevel)));
+}
@@ -0,0 +1,210 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file FieldSensorInterferenceEstimator.hpp
+ *
+ * Online estimator of the linear interference of vehicle inputs (eg. motor current and throttle) on a
+ * magnetometer, using gyroscope data to predict the change of the external field between two samples.
+ *
+ * Model, field sensor data in the body frame:
+ *  field = field_earth + bias + C * input
+ *
+ * The earth field rotates with the angular velocity, bias and interference are fixed in the body frame.
+ * The part of the field change between two samples that is not explained by the rotation is fitted to the
+ * change of the inputs with a recursive least squares filter with exponential forgetting. Using differences
+ * makes the fit independent of the earth field and of the (slowly varying) bias.
+ */
+
+#pragma once
+
+#include <mathlib/mathlib.h>
+#include <matrix/matrix/math.hpp>
+
+class FieldSensorInterferenceEstimator
+{
+public:
+	static constexpr int INPUTS = 2;
+
+	using Inputs = matrix::Vector2f;
+	using Coefficients = matrix::Matrix<float, 3, INPUTS>;
+
+	FieldSensorInterferenceEstimator() { reset(); }
+	~FieldSensorInterferenceEstimator() = default;
+
+	void reset()
+	{
+		_coefficients.zero();
+		_P.setIdentity();
+		_P *= P_INIT;
+		_field_prev.zero();
+		_input_prev.zero();
+		_field_change_var = 0.f;
+		_residual_var = 0.f;
+		_update_count = 0;
+		_initialized = false;
+	}
+
+	/**
+	 * Restart the differences (eg. after a data gap) without discarding the fitted coefficients.
+	 */
+	void resetDifferences() { _initialized = false; }
+
+	void setForgettingFactor(float forgetting_factor) { _forgetting_factor = math::constrain(forgetting_factor, 0.9f, 1.f); }
+
+	/**
+	 * Minimum change of each input between two samples for the sample to be used in the fit.
+	 * Without excitation the samples carry no information and the forgetting factor would inflate the covariance.
+	 */
+	void setExcitationMin(const Inputs &excitation_min) { _excitation_min = excitation_min; }
+
+	/**
+	 * Update the estimator.
+	 * @param gyro bias corrected gyroscope data in the same coordinate frame as the field sensor data
+	 * @param field field sensor data, not compensated for interference
+	 * @param input interference inputs at the time of the field sample
+	 * @param dt time in seconds since the last update
+	 * @return true if the sample was used in the fit
+	 */
+	bool updateEstimate(const matrix::Vector3f &gyro, const matrix::Vector3f &field, const Inputs &input, const float dt)
+	{
+		if (!_initialized) {
+			_field_prev = field;
+			_input_prev = input;
+			_initialized = true;
+			return false;
+		}
+
+		// field change not explained by the rotation of the earth field
+		const matrix::Vector3f field_pred = _field_prev + (-gyro % (_field_prev - _coefficients * _input_prev)) * dt;
+		const matrix::Vector3f field_change = field - field_pred;
+		const Inputs input_change = input - _input_prev;
+
+		_field_prev = field;
+		_input_prev = input;
+
+		bool excited = false;
+
+		for (int j = 0; j < INPUTS; j++) {
+			if (fabsf(input_change(j)) >= _excitation_min(j)) {
+				excited = true;
+			}
+		}
+
+		if (!excited || !field_change.isAllFinite() || !input_change.isAllFinite()) {
+			return false;
+		}
+
+		// recursive least squares, the three axes share the regressor and covariance
+		const Inputs P_phi = _P * input_change;
+		const float denom = _forgetting_factor + input_change.dot(P_phi);
+
+		if (denom < FLT_EPSILON) {
+			return false;
+		}
+
+		const Inputs K = P_phi / denom;
+		const matrix::Vector3f innovation = field_change - _coefficients * input_change;
+
+		for (int i = 0; i < 3; i++) {
+			for (int j = 0; j < INPUTS; j++) {
+				_coefficients(i, j) += innovation(i) * K(j);
+			}
+		}
+
+		const float forgetting_factor_inv = 1.f / _forgetting_factor;
+
+		for (int i = 0; i < INPUTS; i++) {
+			for (int j = i; j < INPUTS; j++) {
+				const float P_ij = (_P(i, j) - K(i) * P_phi(j)) * forgetting_factor_inv;
+				_P(i, j) = P_ij;
+				_P(j, i) = P_ij;
+			}
+		}
+
+		// fit quality statistics
+		const matrix::Vector3f residual = field_change - _coefficients * input_change;
+		const float alpha = (_update_count < FIT_STATISTICS_SAMPLES) ? 1.f / (_update_count + 1) : 1.f / FIT_STATISTICS_SAMPLES;
+		_field_change_var += alpha * (field_change.norm_squared() - _field_change_var);
+		_residual_var += alpha * (residual.norm_squared() - _residual_var);
+
+		if (_update_count < UINT16_MAX) {
+			_update_count++;
+		}
+
+		return true;
+	}
+
+	/**
+	 * Interference coefficients, column j is the field per unit of input j.
+	 */
+	const Coefficients &getCoefficients() const { return _coefficients; }
+
+	matrix::Vector3f getInterference(const Inputs &input) const { return _coefficients * input; }
+
+	/**
+	 * Fraction of the (non-rotational) field changes explained by the interference model [0, 1].
+	 */
+	float getFitQuality() const
+	{
+		if (_field_change_var > FLT_EPSILON) {
+			return math::constrain(1.f - _residual_var / _field_change_var, 0.f, 1.f);
+		}
+
+		return 0.f;
+	}
+
+	float getResidualRms() const { return sqrtf(_residual_var); }
+
+	uint16_t updateCount() const { return _update_count; }
+
+private:
+	static constexpr float P_INIT = 100.f;
+	static constexpr uint16_t FIT_STATISTICS_SAMPLES = 200;
+
+	Coefficients _coefficients{};
+	matrix::SquareMatrix<float, INPUTS> _P{};
+
+	matrix::Vector3f _field_prev{};
+	Inputs _input_prev{};
+
+	Inputs _excitation_min{};
+	float _forgetting_factor{0.999f};
+
+	float _field_change_var{0.f};
+	float _residual_var{0.f};
+
+	uint16_t _update_count{0};
+	bool _initialized{false};
+};
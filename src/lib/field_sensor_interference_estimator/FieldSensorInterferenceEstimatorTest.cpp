@@ -0,0 +1,136 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * Test code for the Field Sensor Interference Estimator
+ * Run this test only using make tests TESTFILTER=FieldSensorInterferenceEstimator
+ */
+
+#include <gtest/gtest.h>
+#include <FieldSensorInterferenceEstimator.hpp>
+
+#include <random>
+
+using namespace matrix;
+
+using Inputs = FieldSensorInterferenceEstimator::Inputs;
+
+class FieldSensorInterferenceEstimatorTest : public ::testing::Test
+{
+public:
+	void SetUp() override
+	{
+		_estimator.setExcitationMin(Inputs{0.0005f, 0.005f});
+	}
+
+	// rotate the vehicle and vary current & throttle, returns the number of samples used in the fit
+	int run(const Vector3f &coefficients_current, const Vector3f &coefficients_throttle, float noise_std, int samples)
+	{
+		std::mt19937 gen(1);
+		std::normal_distribution<float> noise(0.f, noise_std);
+		std::uniform_real_distribution<float> throttle_step(-0.05f, 0.05f);
+		std::uniform_real_distribution<float> current_step(-0.002f, 0.002f);
+
+		const float dt = 0.02f;
+		const Vector3f bias(0.05f, -0.1f, 0.08f);
+		Vector3f field_earth(0.21f, 0.01f, 0.42f);
+		float throttle = 0.5f;
+		float current_other = 0.f; // current not driven by the motors (payload, servos)
+		int used = 0;
+
+		for (int i = 0; i < samples; i++) {
+			const float t = i * dt;
+			const Vector3f gyro(0.3f * sinf(0.5f * t), 0.2f * cosf(0.3f * t), 0.1f);
+
+			throttle = math::constrain(throttle + throttle_step(gen), 0.1f, 1.f);
+			current_other = math::constrain(current_other + current_step(gen), 0.f, 0.02f);
+			const float current = 0.08f * throttle * throttle + current_other; // [kA]
+
+			const Vector3f field = field_earth + bias
+					       + coefficients_current * current
+					       + coefficients_throttle * throttle
+					       + Vector3f(noise(gen), noise(gen), noise(gen));
+
+			if (_estimator.updateEstimate(gyro, field, Inputs{current, throttle}, dt)) {
+				used++;
+			}
+
+			field_earth = Dcmf(AxisAnglef(-gyro * dt)) * field_earth;
+		}
+
+		return used;
+	}
+
+	FieldSensorInterferenceEstimator _estimator;
+};
+
+TEST_F(FieldSensorInterferenceEstimatorTest, currentAndThrottle)
+{
+	const Vector3f coefficients_current(1.2f, -0.6f, 2.f); // [Ga/kA]
+	const Vector3f coefficients_throttle(0.05f, 0.02f, -0.08f); // [Ga]
+
+	const int used = run(coefficients_current, coefficients_throttle, 0.001f, 5000);
+	EXPECT_GT(used, 4000);
+
+	const FieldSensorInterferenceEstimator::Coefficients &coefficients = _estimator.getCoefficients();
+
+	for (int i = 0; i < 3; i++) {
+		EXPECT_NEAR(coefficients(i, 0), coefficients_current(i), 0.15f) << "current axis " << i;
+		EXPECT_NEAR(coefficients(i, 1), coefficients_throttle(i), 0.015f) << "throttle axis " << i;
+	}
+
+	EXPECT_GT(_estimator.getFitQuality(), 0.5f);
+	EXPECT_LT(_estimator.getResidualRms(), 0.01f);
+}
+
+TEST_F(FieldSensorInterferenceEstimatorTest, noInterference)
+{
+	run(Vector3f{}, Vector3f{}, 0.001f, 5000);
+
+	// nothing to explain, the coefficients stay small and the fit is poor
+	EXPECT_LT(_estimator.getCoefficients().abs().max(), 0.1f);
+	EXPECT_LT(_estimator.getFitQuality(), 0.2f);
+}
+
+TEST_F(FieldSensorInterferenceEstimatorTest, noExcitation)
+{
+	Vector3f field(0.2f, 0.f, 0.4f);
+
+	for (int i = 0; i < 100; i++) {
+		EXPECT_FALSE(_estimator.updateEstimate(Vector3f{}, field, Inputs{0.01f, 0.3f}, 0.02f));
+	}
+
+	EXPECT_EQ(_estimator.updateCount(), 0);
+	EXPECT_FLOAT_EQ(_estimator.getFitQuality(), 0.f);
+}
@@ -0,0 +1,109 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file FieldSensorInterferenceInputs.hpp
+ *
+ * Interference inputs shared by the online estimator and the compensation applying its result:
+ * battery current [kA] and mean absolute motor throttle [0, 1].
+ */
+
+#pragma once
+
+#include "FieldSensorInterferenceEstimator.hpp"
+
+#include <px4_platform_common/defines.h>
+#include <uORB/Subscription.hpp>
+#include <uORB/topics/actuator_motors.h>
+#include <uORB/topics/battery_status.h>
+
+class FieldSensorInterferenceInputs
+{
+public:
+	FieldSensorInterferenceInputs() = default;
+	~FieldSensorInterferenceInputs() = default;
+
+	/**
+	 * Poll battery_status and actuator_motors and update the inputs.
+	 * @return true if any of the inputs was updated
+	 */
+	bool update()
+	{
+		bool updated = false;
+
+		battery_status_s battery_status;
+
+		if (_battery_status_sub.update(&battery_status)) {
+			if (battery_status.connected && PX4_ISFINITE(battery_status.current_a)) {
+				_inputs(0) = battery_status.current_a * 0.001f; // current in [kA]
+
+			} else {
+				_inputs(0) = 0.f;
+			}
+
+			updated = true;
+		}
+
+		actuator_motors_s actuator_motors;
+
+		if (_actuator_motors_sub.update(&actuator_motors)) {
+			// mean absolute motor command, disarmed (NaN) motors don't contribute
+			float throttle_sum = 0.f;
+			int motor_count = 0;
+
+			for (int i = 0; i < actuator_motors_s::NUM_CONTROLS; i++) {
+				if (PX4_ISFINITE(actuator_motors.control[i])) {
+					throttle_sum += fabsf(actuator_motors.control[i]);
+					motor_count++;
+				}
+			}
+
+			_inputs(1) = (motor_count > 0) ? throttle_sum / motor_count : 0.f;
+			updated = true;
+		}
+
+		return updated;
+	}
+
+	const FieldSensorInterferenceEstimator::Inputs &get() const { return _inputs; }
+
+	float current() const { return _inputs(0); }
+	float throttle() const { return _inputs(1); }
+
+private:
+	uORB::Subscription _battery_status_sub{ORB_ID(battery_status), 0};
+	uORB::Subscription _actuator_motors_sub{ORB_ID(actuator_motors)};
+
+	FieldSensorInterferenceEstimator::Inputs _inputs{};
+};
@@ -0,0 +1,377 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file BiquadFilterBank.hpp
+ *
+ * @brief Bank of cascaded biquad sections filtering several channels in lock-step.
+ */
+
+#pragma once
+
+#include <mathlib/math/Functions.hpp>
+#include <float.h>
+#include <stdint.h>
+
+#if defined(__ARM_NEON)
+# include <arm_neon.h>
+#elif defined(__SSE__)
+# include <xmmintrin.h>
+#endif
+
+namespace math
+{
+
+/**
+ * Cascade of direct form I biquad sections applied to up to CHANNELS channels at once
+ * (e.g. the 3 gyro axes).
+ *
+ * Coefficients and state are stored as structure of arrays, one CHANNELS wide vector per section,
+ * and the samples are interleaved by channel (data[n][channel]). Each active section runs over the
+ * whole batch for all channels in a single pass with its state kept in registers, using NEON or SSE
+ * where available. Channels of a section that are disabled pass their input through unchanged,
+ * sections without any enabled channel are skipped.
+ *
+ * The filtering is equivalent to NotchFilter<float>::applyArray() for each section in order,
+ * including the reset of the state to the steady state of the first sample.
+ */
+class BiquadFilterBank
+{
+public:
+	static constexpr int CHANNELS = 4;
+
+	BiquadFilterBank() = default;
+	~BiquadFilterBank() { free(); }
+
+	BiquadFilterBank(const BiquadFilterBank &) = delete;
+	BiquadFilterBank &operator=(const BiquadFilterBank &) = delete;
+
+	/**
+	 * (Re)allocate the bank, all sections start disabled.
+	 * @return false if the allocation failed
+	 */
+	bool allocate(int num_sections)
+	{
+		if (num_sections != _num_sections) {
+			free();
+
+			if (num_sections > 0) {
+				_sections = new Section[num_sections] {};
+				_active = new uint16_t[num_sections];
+
+				if ((_sections == nullptr) || (_active == nullptr)) {
+					free();
+					return false;
+				}
+
+				_num_sections = num_sections;
+			}
+		}
+
+		for (int section = 0; section < _num_sections; section++) {
+			for (int channel = 0; channel < CHANNELS; channel++) {
+				disable(section, channel);
+			}
+		}
+
+		return true;
+	}
+
+	int size() const { return _num_sections; }
+
+	/**
+	 * Set the coefficients of a section channel, normalized by a0 (see NotchFilter::getCoefficients()).
+	 * The state is preserved (direct form I) unless reset is set, in which case it is initialized from
+	 * the next sample.
+	 */
+	void setCoefficients(int section, int channel, const float a[3], const float b[3], bool reset)
+	{
+		if ((section < 0) || (section >= _num_sections) || (channel < 0) || (channel >= CHANNELS)) {
+			return;
+		}
+
+		Section &s = _sections[section];
+		s.b0[channel] = b[0];
+		s.b1[channel] = b[1];
+		s.b2[channel] = b[2];
+		s.a1[channel] = a[1];
+		s.a2[channel] = a[2];
+
+		const uint8_t mask = 1 << channel;
+
+		if (reset || !(s.enabled & mask)) {
+			s.reset |= mask;
+		}
+
+		if (!(s.enabled & mask)) {
+			s.enabled |= mask;
+			_active_update = true;
+		}
+	}
+
+	void disable(int section, int channel)
+	{
+		if ((section < 0) || (section >= _num_sections) || (channel < 0) || (channel >= CHANNELS)) {
+			return;
+		}
+
+		Section &s = _sections[section];
+		s.b0[channel] = 1.f;
+		s.b1[channel] = 0.f;
+		s.b2[channel] = 0.f;
+		s.a1[channel] = 0.f;
+		s.a2[channel] = 0.f;
+
+		// pass-through, keep the state finite for the vectorized sections
+		s.x1[channel] = s.x2[channel] = 0.f;
+		s.y1[channel] = s.y2[channel] = 0.f;
+
+		const uint8_t mask = 1 << channel;
+		s.reset &= ~mask;
+
+		if (s.enabled & mask) {
+			s.enabled &= ~mask;
+			_active_update = true;
+		}
+	}
+
+	bool enabled(int section, int channel) const
+	{
+		return (section >= 0) && (section < _num_sections) && (_sections[section].enabled & (1 << channel));
+	}
+
+	/**
+	 * Filter a batch of samples in place through all active sections
+	 * @param data samples interleaved by channel, unused channels must be finite (e.g. 0)
+	 */
+	void apply(float data[][CHANNELS], int num_samples)
+	{
+		if (num_samples <= 0) {
+			return;
+		}
+
+		if (_active_update) {
+			updateActive();
+		}
+
+		for (int i = 0; i < _num_active; i++) {
+			Section &s = _sections[_active[i]];
+
+			if (s.reset) {
+				resetState(s, data[0]);
+			}
+
+			applySection(s, data, num_samples);
+		}
+	}
+
+private:
+	struct Section {
+		// coefficients normalized by a0
+		float b0[CHANNELS];
+		float b1[CHANNELS];
+		float b2[CHANNELS];
+		float a1[CHANNELS];
+		float a2[CHANNELS];
+
+		// delayed inputs & outputs
+		float x1[CHANNELS];
+		float x2[CHANNELS];
+		float y1[CHANNELS];
+		float y2[CHANNELS];
+
+		uint8_t enabled; // channel mask
+		uint8_t reset;   // channels to initialize from the next sample
+	};
+
+	void free()
+	{
+		delete[] _sections;
+		delete[] _active;
+		_sections = nullptr;
+		_active = nullptr;
+		_num_sections = 0;
+		_num_active = 0;
+	}
+
+	void updateActive()
+	{
+		_num_active = 0;
+
+		for (int section = 0; section < _num_sections; section++) {
+			if (_sections[section].enabled) {
+				_active[_num_active++] = section;
+			}
+		}
+
+		_active_update = false;
+	}
+
+	// steady state for the sample (NotchFilter::reset())
+	static void resetState(Section &s, const float sample[CHANNELS])
+	{
+		for (int channel = 0; channel < CHANNELS; channel++) {
+			if (s.reset & (1 << channel)) {
+				const float input = isFinite(sample[channel]) ? sample[channel] : 0.f;
+				float output = input * (s.b0[channel] + s.b1[channel] + s.b2[channel]) / (1.f + s.a1[channel] + s.a2[channel]);
+
+				if (!isFinite(output)) {
+					output = 0.f;
+				}
+
+				s.x1[channel] = s.x2[channel] = input;
+				s.y1[channel] = s.y2[channel] = output;
+			}
+		}
+
+		s.reset = 0;
+	}
+
+	static void applySection(Section &s, float data[][CHANNELS], int num_samples)
+	{
+#if defined(__ARM_NEON)
+		const float32x4_t b0 = vld1q_f32(s.b0);
+		const float32x4_t b1 = vld1q_f32(s.b1);
+		const float32x4_t b2 = vld1q_f32(s.b2);
+		const float32x4_t a1 = vld1q_f32(s.a1);
+		const float32x4_t a2 = vld1q_f32(s.a2);
+
+		float32x4_t x1 = vld1q_f32(s.x1);
+		float32x4_t x2 = vld1q_f32(s.x2);
+		float32x4_t y1 = vld1q_f32(s.y1);
+		float32x4_t y2 = vld1q_f32(s.y2);
+
+		for (int n = 0; n < num_samples; n++) {
+			const float32x4_t x0 = vld1q_f32(data[n]);
+			float32x4_t y0 = vmulq_f32(b0, x0);
+			y0 = vaddq_f32(y0, vmulq_f32(b1, x1));
+			y0 = vaddq_f32(y0, vmulq_f32(b2, x2));
+			y0 = vsubq_f32(y0, vmulq_f32(a1, y1));
+			y0 = vsubq_f32(y0, vmulq_f32(a2, y2));
+
+			x2 = x1;
+			x1 = x0;
+			y2 = y1;
+			y1 = y0;
+
+			vst1q_f32(data[n], y0);
+		}
+
+		vst1q_f32(s.x1, x1);
+		vst1q_f32(s.x2, x2);
+		vst1q_f32(s.y1, y1);
+		vst1q_f32(s.y2, y2);
+
+#elif defined(__SSE__)
+		const __m128 b0 = _mm_loadu_ps(s.b0);
+		const __m128 b1 = _mm_loadu_ps(s.b1);
+		const __m128 b2 = _mm_loadu_ps(s.b2);
+		const __m128 a1 = _mm_loadu_ps(s.a1);
+		const __m128 a2 = _mm_loadu_ps(s.a2);
+
+		__m128 x1 = _mm_loadu_ps(s.x1);
+		__m128 x2 = _mm_loadu_ps(s.x2);
+		__m128 y1 = _mm_loadu_ps(s.y1);
+		__m128 y2 = _mm_loadu_ps(s.y2);
+
+		for (int n = 0; n < num_samples; n++) {
+			const __m128 x0 = _mm_loadu_ps(data[n]);
+			__m128 y0 = _mm_mul_ps(b0, x0);
+			y0 = _mm_add_ps(y0, _mm_mul_ps(b1, x1));
+			y0 = _mm_add_ps(y0, _mm_mul_ps(b2, x2));
+			y0 = _mm_sub_ps(y0, _mm_mul_ps(a1, y1));
+			y0 = _mm_sub_ps(y0, _mm_mul_ps(a2, y2));
+
+			x2 = x1;
+			x1 = x0;
+			y2 = y1;
+			y1 = y0;
+
+			_mm_storeu_ps(data[n], y0);
+		}
+
+		_mm_storeu_ps(s.x1, x1);
+		_mm_storeu_ps(s.x2, x2);
+		_mm_storeu_ps(s.y1, y1);
+		_mm_storeu_ps(s.y2, y2);
+
+#else
+		// scalar FPU (e.g. Cortex-M), only the enabled channels are processed
+		for (int channel = 0; channel < CHANNELS; channel++) {
+			if (!(s.enabled & (1 << channel))) {
+				continue;
+			}
+
+			const float b0 = s.b0[channel];
+			const float b1 = s.b1[channel];
+			const float b2 = s.b2[channel];
+			const float a1 = s.a1[channel];
+			const float a2 = s.a2[channel];
+
+			float x1 = s.x1[channel];
+			float x2 = s.x2[channel];
+			float y1 = s.y1[channel];
+			float y2 = s.y2[channel];
+
+			for (int n = 0; n < num_samples; n++) {
+				const float x0 = data[n][channel];
+				const float y0 = b0 * x0 + b1 * x1 + b2 * x2 - a1 * y1 - a2 * y2;
+
+				x2 = x1;
+				x1 = x0;
+				y2 = y1;
+				y1 = y0;
+
+				data[n][channel] = y0;
+			}
+
+			s.x1[channel] = x1;
+			s.x2[channel] = x2;
+			s.y1[channel] = y1;
+			s.y2[channel] = y2;
+		}
+
+#endif
+	}
+
+	Section *_sections{nullptr};
+	uint16_t *_active{nullptr};
+
+	int _num_sections{0};
+	int _num_active{0};
+
+	bool _active_update{false};
+};
+
+} // namespace math
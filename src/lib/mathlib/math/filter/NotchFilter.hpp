@@ -90,7 +90,7 @@ public:
 	float getNotchFreq() const { return _notch_freq; }
 	float getBandwidth() const { return _bandwidth; }
 
-	// Used in unit test only
+	// Used in unit tests and to set up a BiquadFilterBank
 	void getCoefficients(float a[3], float b[3]) const
 	{
 		a[0] = 1.f;
@@ -0,0 +1,179 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * Test code for the biquad filter bank
+ * Run this test only using make tests TESTFILTER=BiquadFilterBank
+ */
+
+#include <gtest/gtest.h>
+
+#include <lib/mathlib/math/filter/BiquadFilterBank.hpp>
+#include <lib/mathlib/math/filter/NotchFilter.hpp>
+
+using namespace math;
+
+class BiquadFilterBankTest : public ::testing::Test
+{
+public:
+	// 8 ESCs with 3 harmonics, 3 FFT peaks and 2 static notches, as configured on an octocopter
+	static constexpr int NUM_SECTIONS = 8 * 3 + 3 + 2;
+	static constexpr int FIFO_SIZE = 32;
+	static constexpr float SAMPLE_FREQ = 8000.f;
+
+	void SetUp() override
+	{
+		for (int section = 0; section < NUM_SECTIONS; section++) {
+			for (int axis = 0; axis < 3; axis++) {
+				// spread the notches between 50 Hz and 1 kHz, slightly different per axis
+				const float notch_freq = 50.f + 33.f * section + 2.f * axis;
+				_notch[axis][section].setParameters(SAMPLE_FREQ, notch_freq, 20.f);
+			}
+		}
+
+		ASSERT_TRUE(_bank.allocate(NUM_SECTIONS));
+		syncBank();
+	}
+
+	void syncBank()
+	{
+		for (int section = 0; section < NUM_SECTIONS; section++) {
+			for (int axis = 0; axis < 3; axis++) {
+				NotchFilter<float> &nf = _notch[axis][section];
+
+				if (nf.getNotchFreq() > 0.f) {
+					float a[3];
+					float b[3];
+					nf.getCoefficients(a, b);
+					_bank.setCoefficients(section, axis, a, b, false);
+
+				} else {
+					_bank.disable(section, axis);
+				}
+			}
+		}
+	}
+
+	float input(int n, int axis) const
+	{
+		const float t = n / SAMPLE_FREQ;
+		return 0.1f * axis + sinf(2.f * M_PI_F * 83.f * t) + 0.5f * sinf(2.f * M_PI_F * (400.f + 10.f * axis) * t);
+	}
+
+	// reference: every notch filter doing its own pass, as done before in VehicleAngularVelocity
+	void applyChain(float data[3][FIFO_SIZE], int N)
+	{
+		for (int axis = 0; axis < 3; axis++) {
+			for (int section = 0; section < NUM_SECTIONS; section++) {
+				if (_notch[axis][section].getNotchFreq() > 0.f) {
+					_notch[axis][section].applyArray(data[axis], N);
+				}
+			}
+		}
+	}
+
+	NotchFilter<float> _notch[3][NUM_SECTIONS] {};
+	BiquadFilterBank _bank{};
+};
+
+TEST_F(BiquadFilterBankTest, matchesNotchFilterChain)
+{
+	for (int batch = 0; batch < 100; batch++) {
+		float chain[3][FIFO_SIZE];
+		float bank[FIFO_SIZE][BiquadFilterBank::CHANNELS] {};
+
+		for (int n = 0; n < FIFO_SIZE; n++) {
+			for (int axis = 0; axis < 3; axis++) {
+				chain[axis][n] = input(batch * FIFO_SIZE + n, axis);
+				bank[n][axis] = chain[axis][n];
+			}
+		}
+
+		applyChain(chain, FIFO_SIZE);
+		_bank.apply(bank, FIFO_SIZE);
+
+		for (int n = 0; n < FIFO_SIZE; n++) {
+			for (int axis = 0; axis < 3; axis++) {
+				EXPECT_NEAR(bank[n][axis], chain[axis][n], 1e-5f) << "batch " << batch << " sample " << n << " axis " << axis;
+			}
+
+			// unused channel untouched
+			EXPECT_EQ(bank[n][3], 0.f);
+		}
+	}
+}
+
+TEST_F(BiquadFilterBankTest, disabledChannelPassThrough)
+{
+	for (int section = 0; section < NUM_SECTIONS; section++) {
+		_notch[1][section].disable();
+	}
+
+	syncBank();
+	EXPECT_FALSE(_bank.enabled(0, 1));
+	EXPECT_TRUE(_bank.enabled(0, 0));
+
+	float bank[FIFO_SIZE][BiquadFilterBank::CHANNELS] {};
+
+	for (int n = 0; n < FIFO_SIZE; n++) {
+		bank[n][1] = input(n, 1);
+	}
+
+	_bank.apply(bank, FIFO_SIZE);
+
+	for (int n = 0; n < FIFO_SIZE; n++) {
+		EXPECT_FLOAT_EQ(bank[n][1], input(n, 1));
+	}
+}
+
+TEST_F(BiquadFilterBankTest, resetToSteadyState)
+{
+	// a constant input passes through a freshly initialized notch cascade unchanged (unity DC gain)
+	float bank[FIFO_SIZE][BiquadFilterBank::CHANNELS];
+
+	for (int n = 0; n < FIFO_SIZE; n++) {
+		bank[n][0] = 1.5f;
+		bank[n][1] = -2.f;
+		bank[n][2] = 0.25f;
+		bank[n][3] = 0.f;
+	}
+
+	_bank.apply(bank, FIFO_SIZE);
+
+	for (int n = 0; n < FIFO_SIZE; n++) {
+		EXPECT_NEAR(bank[n][0], 1.5f, 1e-3f);
+		EXPECT_NEAR(bank[n][1], -2.f, 1e-3f);
+		EXPECT_NEAR(bank[n][2], 0.25f, 1e-3f);
+	}
+}
@@ -58,7 +58,7 @@ public:
 	RingBuffer(RingBuffer &&) = delete;
 	RingBuffer &operator=(RingBuffer &&) = delete;
 
-	bool allocate(uint8_t size)
+	bool allocate(uint16_t size)
 	{
 		if (valid() && (size == _size)) {
 			// no change
@@ -90,10 +90,15 @@ public:
 
 	void push(const data_type &sample)
 	{
-		uint8_t head_new = _head;
+		uint16_t head_new = _head;
 
 		if (!_first_write) {
 			head_new = (_head + 1) % _size;
+
+			// samples are normally pushed in time order, which allows searching by timestamp
+			if (sample.time_us < _buffer[_head].time_us) {
+				_sorted = false;
+			}
 		}
 
 		_buffer[head_new] = sample;
@@ -108,49 +113,86 @@ public:
 		}
 	}
 
-	uint8_t get_length() const { return _size; }
+	uint16_t get_length() const { return _size; }
 
-	data_type &operator[](const uint8_t index) { return _buffer[index]; }
+	data_type &operator[](const uint16_t index) { return _buffer[index]; }
 
 	const data_type &get_newest() const { return _buffer[_head]; }
 	const data_type &get_oldest() const { return _buffer[_tail]; }
 
-	uint8_t get_oldest_index() const { return _tail; }
+	uint16_t get_oldest_index() const { return _tail; }
+
+	// number of samples between the oldest and the newest one
+	uint16_t count() const { return _first_write ? 0 : ((_head + _size - _tail) % _size) + 1; }
 
 	bool pop_first_older_than(const uint64_t &timestamp, data_type *sample)
 	{
-		// start looking from newest observation data
-		for (uint8_t i = 0; i < _size; i++) {
-			int index = (_head - i);
-			index = index < 0 ? _size + index : index;
+		if (!_sorted) {
+			return pop_first_older_than_linear(timestamp, sample);
+		}
 
-			if (timestamp >= _buffer[index].time_us && timestamp < _buffer[index].time_us + (uint64_t)1e5) {
-				*sample = _buffer[index];
+		// binary search for the newest sample that is not newer than the timestamp
+		const uint16_t index_newer = upper_bound(timestamp);
 
-				// Now we can set the tail to the item which
-				// comes after the one we removed since we don't
-				// want to have any older data in the buffer
-				if (index == _head) {
-					_tail = _head;
-					_first_write = true;
+		if (index_newer == 0) {
+			// empty or all the samples are newer
+			return false;
+		}
+
+		const uint16_t index = (_tail + index_newer - 1) % _size;
+
+		// all the older samples are even further from the timestamp
+		if (timestamp >= _buffer[index].time_us + (uint64_t)1e5) {
+			return false;
+		}
+
+		pop(index, sample);
+		return true;
+	}
+
+	// discard all the samples older than the timestamp, return the number of discarded samples
+	uint16_t discard_older_than(const uint64_t &timestamp)
+	{
+		uint16_t discarded = 0;
+
+		if (_sorted) {
+			uint16_t lo = 0;
+			uint16_t hi = count();
+
+			// first sample that is not older than the timestamp
+			while (lo < hi) {
+				const uint16_t mid = lo + (hi - lo) / 2;
+
+				if (_buffer[(_tail + mid) % _size].time_us < timestamp) {
+					lo = mid + 1;
 
 				} else {
-					_tail = (index + 1) % _size;
+					hi = mid;
 				}
+			}
 
-				_buffer[index].time_us = 0;
+			discarded = lo;
 
-				return true;
+		} else {
+			while ((discarded < count()) && (_buffer[(_tail + discarded) % _size].time_us < timestamp)) {
+				discarded++;
 			}
+		}
 
-			if (index == _tail) {
-				// we have reached the tail and haven't got a
-				// match
-				return false;
-			}
+		if (discarded == 0) {
+			return 0;
 		}
 
-		return false;
+		if (discarded == count()) {
+			_tail = _head;
+			_first_write = true;
+			_sorted = true;
+
+		} else {
+			_tail = (_tail + discarded) % _size;
+		}
+
+		return discarded;
 	}
 
 	int get_used_size() const { return sizeof(*this) + sizeof(data_type) * entries(); }
@@ -160,7 +202,7 @@ public:
 	{
 		int count = 0;
 
-		for (uint8_t i = 0; i < _size; i++) {
+		for (uint16_t i = 0; i < _size; i++) {
 			if (_buffer[i].time_us != 0) {
 				count++;
 			}
@@ -172,24 +214,87 @@ public:
 	void reset()
 	{
 		if (_buffer) {
-			for (uint8_t i = 0; i < _size; i++) {
+			for (uint16_t i = 0; i < _size; i++) {
 				_buffer[i] = {};
 			}
 
 			_head = 0;
 			_tail = 0;
 			_first_write = true;
+			_sorted = true;
 		}
 	}
 
 private:
+	// number of samples from the oldest that are not newer than the timestamp
+	uint16_t upper_bound(const uint64_t &timestamp) const
+	{
+		uint16_t lo = 0;
+		uint16_t hi = count();
+
+		while (lo < hi) {
+			const uint16_t mid = lo + (hi - lo) / 2;
+
+			if (_buffer[(_tail + mid) % _size].time_us <= timestamp) {
+				lo = mid + 1;
+
+			} else {
+				hi = mid;
+			}
+		}
+
+		return lo;
+	}
+
+	bool pop_first_older_than_linear(const uint64_t &timestamp, data_type *sample)
+	{
+		// start looking from newest observation data
+		for (uint16_t i = 0; i < _size; i++) {
+			int index = (_head - i);
+			index = index < 0 ? _size + index : index;
+
+			if (timestamp >= _buffer[index].time_us && timestamp < _buffer[index].time_us + (uint64_t)1e5) {
+				pop(index, sample);
+				return true;
+			}
+
+			if (index == _tail) {
+				// we have reached the tail and haven't got a
+				// match
+				return false;
+			}
+		}
+
+		return false;
+	}
+
+	void pop(const uint16_t index, data_type *sample)
+	{
+		*sample = _buffer[index];
+
+		// Now we can set the tail to the item which
+		// comes after the one we removed since we don't
+		// want to have any older data in the buffer
+		if (index == _head) {
+			_tail = _head;
+			_first_write = true;
+			_sorted = true;
+
+		} else {
+			_tail = (index + 1) % _size;
+		}
+
+		_buffer[index].time_us = 0;
+	}
+
 	data_type *_buffer{nullptr};
 
-	uint8_t _head{0};
-	uint8_t _tail{0};
-	uint8_t _size{0};
+	uint16_t _head{0};
+	uint16_t _tail{0};
+	uint16_t _size{0};
 
 	bool _first_write{true};
+	bool _sorted{true}; ///< samples between tail and head are in time order
 };
 
 #endif // !EKF_RINGBUFFER_H
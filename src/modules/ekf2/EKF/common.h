@@ -267,6 +267,8 @@ struct parameters {
 
 	int32_t filter_update_interval_us{10000}; ///< filter update interval in microseconds
 
+	int32_t smoother_lag{0};                ///< fixed-lag smoother length in filter updates (0 to disable)
+
 	int32_t imu_ctrl{static_cast<int32_t>(ImuCtrl::GyroBias) | static_cast<int32_t>(ImuCtrl::AccelBias)};
 
 	// measurement source control
@@ -230,13 +230,86 @@ void Ekf::predictCovariance(const imuSample &imu_delayed)
 #endif // CONFIG_EKF2_TERRAIN
 
 	// covariance matrix is symmetrical, so copy upper half to lower half
-	for (unsigned row = 0; row < State::size; row++) {
-		for (unsigned column = 0; column < row; column++) {
-			P(row, column) = P(column, row);
+	P.copyUpperToLowerTriangle();
+
+	constrainStateVariances();
+}
+
+void Ekf::updateCovarianceJoseph(const VectorState &K, const VectorState &H, const float R)
+{
+	// Efficient implementation of the Joseph stabilized covariance update
+	// Based on "G. J. Bierman. Factorization Methods for Discrete Sequential Estimation. Academic Press, Dover Publications, New York, 1977, 2006"
+	// P = (I - K * H) * P * (I - K * H).T   + K * R * K.T
+	//   =      P_temp     * (I - H.T * K.T) + K * R * K.T
+	//   =      P_temp - P_temp * H.T * K.T  + K * R * K.T
+	//
+	// Observation jacobians typically only have a few non-zero elements and the gains of inhibited states are zero,
+	// so collect the non-zero indices once and skip all the products that do not contribute.
+	uint8_t h_idx[State::size];
+	uint8_t k_idx[State::size];
+	unsigned h_nnz = 0;
+	unsigned k_nnz = 0;
+
+	for (unsigned i = 0; i < State::size; i++) {
+		if (H(i) != 0.f) {
+			h_idx[h_nnz++] = i;
+		}
+
+		if (K(i) != 0.f) {
+			k_idx[k_nnz++] = i;
 		}
 	}
 
-	constrainStateVariances();
+	// P * H using the non-zero elements of H only
+	auto sparsePH = [&]() {
+		VectorState PH;
+
+		for (unsigned i = 0; i < State::size; i++) {
+			float sum = 0.f;
+
+			for (unsigned n = 0; n < h_nnz; n++) {
+				sum += P(i, h_idx[n]) * H(h_idx[n]);
+			}
+
+			PH(i) = sum;
+		}
+
+		return PH;
+	};
+
+	// Step 1: conventional update
+	// Compute P_temp and store it in P to avoid allocating more memory
+	// P is symmetric, so PH == H.T * P.T == H.T * P. Only the rows with a non-zero gain change.
+	VectorState PH = sparsePH();
+
+	for (unsigned n = 0; n < k_nnz; n++) {
+		const unsigned i = k_idx[n];
+
+		for (unsigned j = 0; j < State::size; j++) {
+			P(i, j) -= K(i) * PH(j); // P is now not symmetrical if K is not optimal (e.g.: some gains have been zeroed)
+		}
+	}
+
+	// Step 2: stabilized update
+	// P (or "P_temp") is not symmetric so we must take the column
+	PH = sparsePH();
+
+	for (unsigned i = 0; i < State::size; i++) {
+		if (K(i) != 0.f) {
+			for (unsigned j = 0; j <= i; j++) {
+				P(i, j) = P(i, j) - PH(i) * K(j) + K(i) * R * K(j);
+				P(j, i) = P(i, j);
+			}
+
+		} else {
+			// rows without gain only change in the columns that have one
+			for (unsigned n = 0; (n < k_nnz) && (k_idx[n] < i); n++) {
+				const unsigned j = k_idx[n];
+				P(i, j) = P(i, j) - PH(i) * K(j);
+				P(j, i) = P(i, j);
+			}
+		}
+	}
 }
 
 void Ekf::constrainStateVariances()
@@ -99,6 +99,7 @@ void Ekf::reset()
 	_gps_alt_ref = NAN;
 
 	_output_predictor.reset();
+	_smoother.reset();
 
 	// Ekf private fields
 	_time_last_horizontal_aiding = 0;
@@ -166,9 +167,13 @@ bool Ekf::update()
 		predictCovariance(imu_sample_delayed);
 		predictState(imu_sample_delayed);
 
+		updateSmootherPrior(imu_sample_delayed);
+
 		// control fusion of observation data
 		controlFusionModes(imu_sample_delayed);
 
+		updateSmootherPosterior();
+
 		_output_predictor.correctOutputStates(imu_sample_delayed.time_us, _state.quat_nominal, _state.vel, _state.pos,
 						      _state.gyro_bias, _state.accel_bias);
 
@@ -276,6 +281,48 @@ void Ekf::predictState(const imuSample &imu_delayed)
 	_height_rate_lpf = _height_rate_lpf * (1.0f - alpha_height_rate_lpf) + _state.vel(2) * alpha_height_rate_lpf;
 }
 
+void Ekf::updateSmootherPrior(const imuSample &imu_delayed)
+{
+	if (!_smoother.allocate(static_cast<uint8_t>(math::constrain(_params.smoother_lag, (int32_t)0,
+				(int32_t)FixedLagSmoother::kMaxLag))) || !_smoother.enabled()) {
+		return;
+	}
+
+	// velocity and position are consecutive in the state vector
+	static_assert(State::pos.idx == State::vel.idx + State::vel.dof, "smoother expects velocity followed by position");
+
+	FixedLagSmoother::Vector6f x;
+	x.slice<3, 1>(0, 0) = _state.vel;
+	x.slice<3, 1>(3, 0) = _state.pos;
+
+	_smoother.storePrior(imu_delayed.time_us, imu_delayed.delta_vel_dt, x,
+			     P.slice<FixedLagSmoother::kNumStates, FixedLagSmoother::kNumStates>(State::vel.idx, State::vel.idx));
+}
+
+void Ekf::updateSmootherPosterior()
+{
+	if (!_smoother.enabled()) {
+		return;
+	}
+
+	const uint8_t reset_count = _state_reset_status.reset_count.velNE + _state_reset_status.reset_count.velD
+				    + _state_reset_status.reset_count.posNE + _state_reset_status.reset_count.posD;
+
+	if (reset_count != _smoother_reset_count) {
+		// the history is not consistent across a state reset
+		_smoother_reset_count = reset_count;
+		_smoother.reset();
+		return;
+	}
+
+	FixedLagSmoother::Vector6f x;
+	x.slice<3, 1>(0, 0) = _state.vel;
+	x.slice<3, 1>(3, 0) = _state.pos;
+
+	_smoother.storePosterior(x, P.slice<FixedLagSmoother::kNumStates, FixedLagSmoother::kNumStates>(State::vel.idx,
+				 State::vel.idx));
+}
+
 bool Ekf::resetGlobalPosToExternalObservation(double lat_deg, double lon_deg, float accuracy,
 		uint64_t timestamp_observation)
 {
@@ -53,6 +53,8 @@
 #include "bias_estimator/height_bias_estimator.hpp"
 #include "bias_estimator/position_bias_estimator.hpp"
 
+#include "fixed_lag_smoother/fixed_lag_smoother.h"
+
 #include <ekf_derivation/generated/state.h>
 
 #include <uORB/topics/estimator_aid_source1d.h>
@@ -246,6 +248,9 @@ public:
 	// get the diagonal elements of the covariance matrix
 	matrix::Vector<float, State::size> covariances_diagonal() const { return P.diag(); }
 
+	// fixed-lag smoother over the velocity and position history at the fusion time horizon
+	FixedLagSmoother &smoother() { return _smoother; }
+
 	matrix::Vector3f getRotVarBody() const;
 	matrix::Vector3f getRotVarNed() const;
 	float getYawVar() const;
@@ -487,33 +492,7 @@ public:
 		const VectorState KR = K * R;
 		P += KR.multiplyByTranspose(K);
 #else
-		// Efficient implementation of the Joseph stabilized covariance update
-		// Based on "G. J. Bierman. Factorization Methods for Discrete Sequential Estimation. Academic Press, Dover Publications, New York, 1977, 2006"
-		// P = (I - K * H) * P * (I - K * H).T   + K * R * K.T
-		//   =      P_temp     * (I - H.T * K.T) + K * R * K.T
-		//   =      P_temp - P_temp * H.T * K.T  + K * R * K.T
-
-		// Step 1: conventional update
-		// Compute P_temp and store it in P to avoid allocating more memory
-		// P is symmetric, so PH == H.T * P.T == H.T * P. Taking the row is faster as matrices are row-major
-		VectorState PH = P * H; // H is stored as a column vector. H is in fact H.T
-
-		for (unsigned i = 0; i < State::size; i++) {
-			for (unsigned j = 0; j < State::size; j++) {
-				P(i, j) -= K(i) * PH(j); // P is now not symmetrical if K is not optimal (e.g.: some gains have been zeroed)
-			}
-		}
-
-		// Step 2: stabilized update
-		PH = P * H; // H is stored as a column vector. H is in fact H.T
-
-		for (unsigned i = 0; i < State::size; i++) {
-			for (unsigned j = 0; j <= i; j++) {
-				P(i, j) = P(i, j) - PH(i) * K(j) + K(i) * R * K(j);
-				P(j, i) = P(i, j);
-			}
-		}
-
+		updateCovarianceJoseph(K, H, R);
 #endif
 
 		constrainStateVariances();
@@ -613,6 +592,12 @@ private:
 
 	SquareMatrixState P{};	///< state covariance matrix
 
+	FixedLagSmoother _smoother{};
+	uint8_t _smoother_reset_count{0};	///< sum of the velocity and position reset counters used by the smoother
+
+	void updateSmootherPrior(const imuSample &imu_delayed);
+	void updateSmootherPosterior();
+
 #if defined(CONFIG_EKF2_DRAG_FUSION)
 	estimator_aid_source2d_s _aid_src_drag {};
 #endif // CONFIG_EKF2_DRAG_FUSION
@@ -939,6 +924,11 @@ private:
 	// limit the diagonal of the covariance matrix
 	void constrainStateVariances();
 
+	// Joseph stabilized covariance update of a single observation with Kalman gain K, observation jacobian H
+	// (stored as a column vector) and observation variance R. Only the rows and columns of P selected by the
+	// non-zero elements of H and K are visited.
+	void updateCovarianceJoseph(const VectorState &K, const VectorState &H, const float R);
+
 	void constrainStateVar(const IdxDof &state, float min, float max);
 	void constrainStateVarLimitRatio(const IdxDof &state, float min, float max, float max_ratio = 1.e6f);
 
@@ -510,7 +510,7 @@ void EstimatorInterface::setDragData(const imuSample &imu)
 		_drag_sample_time_dt += imu.delta_vel_dt;
 
 		// calculate the downsample ratio for drag specific force data
-		uint8_t min_sample_ratio = (uint8_t) ceilf((float)_imu_buffer_length / _obs_buffer_length);
+		uint16_t min_sample_ratio = (uint16_t) ceilf((float)_imu_buffer_length / _obs_buffer_length);
 
 		if (min_sample_ratio < 5) {
 			min_sample_ratio = 5;
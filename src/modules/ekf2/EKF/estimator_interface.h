@@ -326,7 +326,7 @@ protected:
 	 max freq (Hz) = (OBS_BUFFER_LENGTH - 1) / (IMU_BUFFER_LENGTH * FILTER_UPDATE_PERIOD_S)
 	 This can be adjusted to match the max sensor data rate plus some margin for jitter.
 	*/
-	uint8_t _obs_buffer_length{0};
+	uint16_t _obs_buffer_length{0};
 
 	/*
 	IMU_BUFFER_LENGTH defines how many IMU samples we buffer which sets the time delay from current time to the
@@ -334,7 +334,7 @@ protected:
 	max sensor time offet (msec) =  IMU_BUFFER_LENGTH * FILTER_UPDATE_PERIOD_MS
 	This can be adjusted to a value that is FILTER_UPDATE_PERIOD_MS longer than the maximum observation time delay.
 	*/
-	uint8_t _imu_buffer_length{0};
+	uint16_t _imu_buffer_length{0};
 
 	float _dt_ekf_avg{0.010f}; ///< average update rate of the ekf in s
 
@@ -477,7 +477,7 @@ protected:
 	void setDragData(const imuSample &imu);
 
 	// Used by the multi-rotor specific drag force fusion
-	uint8_t _drag_sample_count{0};	// number of drag specific force samples assumulated at the filter prediction rate
+	uint16_t _drag_sample_count{0};	// number of drag specific force samples assumulated at the filter prediction rate
 	float _drag_sample_time_dt{0.0f};	// time integral across all samples used to form _drag_down_sampled (sec)
 #endif // CONFIG_EKF2_DRAG_FUSION
 
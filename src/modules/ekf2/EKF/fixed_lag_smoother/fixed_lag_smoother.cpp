@@ -0,0 +1,229 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include "fixed_lag_smoother.h"
+
+using matrix::SquareMatrix;
+using matrix::Vector3f;
+
+bool FixedLagSmoother::allocate(uint8_t lag)
+{
+	lag = (lag > kMaxLag) ? kMaxLag : lag;
+
+	if (lag == _lag) {
+		return true;
+	}
+
+	delete[] _history;
+	_history = nullptr;
+	_lag = 0;
+
+	if (lag > 0) {
+		_history = new Sample[lag] {};
+
+		if (_history == nullptr) {
+			return false;
+		}
+
+		_lag = lag;
+	}
+
+	reset();
+	return true;
+}
+
+void FixedLagSmoother::reset()
+{
+	_head = 0;
+	_count = 0;
+	_posterior_pending = false;
+	_output = {};
+}
+
+void FixedLagSmoother::storePrior(uint64_t time_us, float dt, const Vector6f &x, const SquareMatrix6f &P)
+{
+	if (_history == nullptr) {
+		return;
+	}
+
+	_head = (_head + 1) % _lag;
+
+	if (_count < _lag) {
+		_count++;
+	}
+
+	Sample &s = _history[_head];
+	s.time_us = time_us;
+	s.dt = dt;
+	s.x_prior = x;
+	s.P_prior = P;
+
+	// no fusion until storePosterior() is called
+	s.x_post = x;
+	s.P_post = P;
+
+	_posterior_pending = true;
+}
+
+void FixedLagSmoother::storePosterior(const Vector6f &x, const SquareMatrix6f &P)
+{
+	if ((_history == nullptr) || !_posterior_pending) {
+		return;
+	}
+
+	Sample &s = _history[_head];
+	s.x_post = x;
+	s.P_post = P;
+
+	_posterior_pending = false;
+}
+
+bool FixedLagSmoother::solveGain(const SquareMatrix6f &P_prior, const SquareMatrix6f &PFt, SquareMatrix6f &C)
+{
+	// Cholesky factorisation P_prior = L * L^T
+	SquareMatrix6f L;
+
+	for (int j = 0; j < kNumStates; j++) {
+		float d = P_prior(j, j);
+
+		for (int k = 0; k < j; k++) {
+			d -= L(j, k) * L(j, k);
+		}
+
+		if (!(d > 0.f)) {
+			return false;
+		}
+
+		L(j, j) = sqrtf(d);
+		const float L_jj_inv = 1.f / L(j, j);
+
+		for (int i = j + 1; i < kNumStates; i++) {
+			float v = P_prior(i, j);
+
+			for (int k = 0; k < j; k++) {
+				v -= L(i, k) * L(j, k);
+			}
+
+			L(i, j) = v * L_jj_inv;
+		}
+	}
+
+	// solve C * L * L^T = PFt row by row (P_prior is symmetric)
+	for (int r = 0; r < kNumStates; r++) {
+		float y[kNumStates];
+
+		// forward substitution: L * y = PFt(r, :)^T
+		for (int i = 0; i < kNumStates; i++) {
+			float v = PFt(r, i);
+
+			for (int k = 0; k < i; k++) {
+				v -= L(i, k) * y[k];
+			}
+
+			y[i] = v / L(i, i);
+		}
+
+		// back substitution: L^T * C(r, :)^T = y
+		for (int i = kNumStates - 1; i >= 0; i--) {
+			float v = y[i];
+
+			for (int k = i + 1; k < kNumStates; k++) {
+				v -= L(k, i) * C(r, k);
+			}
+
+			C(r, i) = v / L(i, i);
+		}
+	}
+
+	return true;
+}
+
+bool FixedLagSmoother::smooth()
+{
+	if ((_history == nullptr) || (_count < _lag)) {
+		return false;
+	}
+
+	// start from the filtered solution at the newest sample
+	Vector6f x_s = sample(0).x_post;
+	SquareMatrix6f P_s = sample(0).P_post;
+
+	for (uint8_t age = 1; age < _count; age++) {
+		const Sample &s = sample(age);
+		const Sample &s_next = sample(age - 1);
+
+		// P_post * F^T with F = [I 0; dt*I I] (velocity then position)
+		SquareMatrix6f PFt = s.P_post;
+
+		for (int row = 0; row < kNumStates; row++) {
+			for (int col = 3; col < kNumStates; col++) {
+				PFt(row, col) += s_next.dt * s.P_post(row, col - 3);
+			}
+		}
+
+		// smoother gain C = P_post * F^T * P_prior^-1
+		SquareMatrix6f C;
+
+		if (!solveGain(s_next.P_prior, PFt, C)) {
+			// badly conditioned history, start over
+			reset();
+			return false;
+		}
+
+		x_s = s.x_post + C * (x_s - s_next.x_prior);
+		P_s = s.P_post + C * (P_s - s_next.P_prior) * C.transpose();
+	}
+
+	const Sample &oldest = sample(_count - 1);
+
+	_output.time_us = oldest.time_us;
+	_output.vel = Vector3f(x_s.slice<3, 1>(0, 0));
+	_output.pos = Vector3f(x_s.slice<3, 1>(3, 0));
+
+	for (int i = 0; i < 3; i++) {
+		_output.vel_var(i) = P_s(i, i);
+		_output.pos_var(i) = P_s(i + 3, i + 3);
+	}
+
+	return true;
+}
+
+float FixedLagSmoother::lagTime() const
+{
+	if ((_history == nullptr) || (_output.time_us == 0)) {
+		return 0.f;
+	}
+
+	return 1e-6f * static_cast<float>(_history[_head].time_us - _output.time_us);
+}
@@ -0,0 +1,135 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file fixed_lag_smoother.h
+ *
+ * Fixed-lag Rauch-Tung-Striebel smoother for the EKF velocity and position states.
+ *
+ * The EKF stores its prior (after prediction) and posterior (after fusion) velocity and position
+ * together with the corresponding covariance blocks at every update of the delayed time horizon.
+ * The backward pass runs over this history and returns the smoothed state at the oldest sample,
+ * i.e. with a fixed lag behind the fusion time horizon. The smoother only reads the EKF history
+ * and never feeds back into the filter or the output predictor.
+ *
+ * The cross-covariances with the attitude and bias states are not included, the state transition
+ * uses the kinematic velocity to position relation only.
+ */
+
+#ifndef EKF_FIXED_LAG_SMOOTHER_H
+#define EKF_FIXED_LAG_SMOOTHER_H
+
+#include <stdint.h>
+
+#include <matrix/math.hpp>
+
+class FixedLagSmoother
+{
+public:
+	static constexpr uint8_t kMaxLag{50}; ///< maximum lag in number of EKF updates
+
+	// smoothed states ordered as velocity (NED) then position (NED), same as the EKF state vector
+	static constexpr uint8_t kNumStates{6};
+	using Vector6f = matrix::Vector<float, kNumStates>;
+	using SquareMatrix6f = matrix::SquareMatrix<float, kNumStates>;
+
+	struct Output {
+		uint64_t time_us{0};
+		matrix::Vector3f vel{};
+		matrix::Vector3f pos{};
+		matrix::Vector3f vel_var{};
+		matrix::Vector3f pos_var{};
+	};
+
+	FixedLagSmoother() = default;
+	~FixedLagSmoother() { delete[] _history; }
+
+	FixedLagSmoother(const FixedLagSmoother &) = delete;
+	FixedLagSmoother &operator=(const FixedLagSmoother &) = delete;
+
+	/**
+	 * (Re)allocate the history for the given lag (number of EKF updates).
+	 * A lag of 0 releases the history and disables the smoother, a lag of 1
+	 * outputs the filtered states at the fusion time horizon unsmoothed.
+	 */
+	bool allocate(uint8_t lag);
+
+	uint8_t lag() const { return _lag; }
+	bool enabled() const { return _history != nullptr; }
+
+	// clear the history (e.g. after a state reset)
+	void reset();
+
+	// store the predicted state and covariance at the fusion time horizon, before fusion
+	void storePrior(uint64_t time_us, float dt, const Vector6f &x, const SquareMatrix6f &P);
+
+	// store the state and covariance after fusion, for the sample stored with the last storePrior()
+	void storePosterior(const Vector6f &x, const SquareMatrix6f &P);
+
+	/**
+	 * Run the backward pass over the stored history.
+	 * @return true if the history is full and the output at the oldest sample has been updated
+	 */
+	bool smooth();
+
+	const Output &output() const { return _output; }
+
+	// lag of the smoothed output behind the newest stored sample (s)
+	float lagTime() const;
+
+private:
+	struct Sample {
+		uint64_t time_us;
+		float dt;              ///< prediction interval leading to this sample (s)
+		Vector6f x_prior;
+		SquareMatrix6f P_prior;
+		Vector6f x_post;
+		SquareMatrix6f P_post;
+	};
+
+	// C = PFt * P_prior^-1 using a Cholesky factorisation of P_prior, false if it is not positive definite
+	static bool solveGain(const SquareMatrix6f &P_prior, const SquareMatrix6f &PFt, SquareMatrix6f &C);
+
+	Sample &sample(uint8_t age) { return _history[(_head + _lag - age) % _lag]; }
+
+	Sample *_history{nullptr};
+	uint8_t _lag{0};
+	uint8_t _head{0};   ///< index of the newest sample
+	uint8_t _count{0};  ///< number of valid samples
+	bool _posterior_pending{false};
+
+	Output _output{};
+};
+
+#endif // !EKF_FIXED_LAG_SMOOTHER_H
@@ -82,7 +82,7 @@ void OutputPredictor::alignOutputFilter(const Quatf &quat_state, const Vector3f
 	const Vector3f pos_delta = pos_state - output_delayed.pos;
 
 	// loop through the output filter state history and add the deltas
-	for (uint8_t i = 0; i < _output_buffer.get_length(); i++) {
+	for (uint16_t i = 0; i < _output_buffer.get_length(); i++) {
 		_output_buffer[i].quat_nominal = q_delta * _output_buffer[i].quat_nominal;
 		_output_buffer[i].quat_nominal.normalize();
 		_output_buffer[i].vel += vel_delta;
@@ -115,11 +115,11 @@ void OutputPredictor::reset()
 
 	_output_tracking_error.setZero();
 
-	for (uint8_t index = 0; index < _output_buffer.get_length(); index++) {
+	for (uint16_t index = 0; index < _output_buffer.get_length(); index++) {
 		_output_buffer[index] = {};
 	}
 
-	for (uint8_t index = 0; index < _output_vert_buffer.get_length(); index++) {
+	for (uint16_t index = 0; index < _output_vert_buffer.get_length(); index++) {
 		_output_vert_buffer[index] = {};
 	}
 }
@@ -127,7 +127,7 @@ void OutputPredictor::reset()
 void OutputPredictor::resetQuaternion(const Quatf &quat_change)
 {
 	// add the reset amount to the output observer buffered data
-	for (uint8_t i = 0; i < _output_buffer.get_length(); i++) {
+	for (uint16_t i = 0; i < _output_buffer.get_length(); i++) {
 		_output_buffer[i].quat_nominal = quat_change * _output_buffer[i].quat_nominal;
 	}
 
@@ -138,7 +138,7 @@ void OutputPredictor::resetQuaternion(const Quatf &quat_change)
 
 void OutputPredictor::resetHorizontalVelocityTo(const Vector2f &delta_horz_vel)
 {
-	for (uint8_t index = 0; index < _output_buffer.get_length(); index++) {
+	for (uint16_t index = 0; index < _output_buffer.get_length(); index++) {
 		_output_buffer[index].vel.xy() += delta_horz_vel;
 	}
 
@@ -147,7 +147,7 @@ void OutputPredictor::resetHorizontalVelocityTo(const Vector2f &delta_horz_vel)
 
 void OutputPredictor::resetVerticalVelocityTo(float delta_vert_vel)
 {
-	for (uint8_t index = 0; index < _output_buffer.get_length(); index++) {
+	for (uint16_t index = 0; index < _output_buffer.get_length(); index++) {
 		_output_buffer[index].vel(2) += delta_vert_vel;
 		_output_vert_buffer[index].vert_vel += delta_vert_vel;
 	}
@@ -158,7 +158,7 @@ void OutputPredictor::resetVerticalVelocityTo(float delta_vert_vel)
 
 void OutputPredictor::resetHorizontalPositionTo(const Vector2f &delta_horz_pos)
 {
-	for (uint8_t index = 0; index < _output_buffer.get_length(); index++) {
+	for (uint16_t index = 0; index < _output_buffer.get_length(); index++) {
 		_output_buffer[index].pos.xy() += delta_horz_pos;
 	}
 
@@ -172,7 +172,7 @@ void OutputPredictor::resetVerticalPositionTo(const float new_vert_pos, const fl
 	_output_new.pos(2) += vert_pos_change;
 
 	// add the reset amount to the output observer buffered data
-	for (uint8_t i = 0; i < _output_buffer.get_length(); i++) {
+	for (uint16_t i = 0; i < _output_buffer.get_length(); i++) {
 		_output_buffer[i].pos(2) += vert_pos_change;
 		_output_vert_buffer[i].vert_vel_integ += vert_pos_change;
 	}
@@ -349,12 +349,12 @@ void OutputPredictor::applyCorrectionToVerticalOutputBuffer(float vert_vel_corre
 {
 	// loop through the vertical output filter state history starting at the oldest and apply the corrections to the
 	// vert_vel states and propagate vert_vel_integ forward using the corrected vert_vel
-	uint8_t index = _output_vert_buffer.get_oldest_index();
+	uint16_t index = _output_vert_buffer.get_oldest_index();
 
-	const uint8_t size = _output_vert_buffer.get_length();
+	const uint16_t size = _output_vert_buffer.get_length();
 
-	for (uint8_t counter = 0; counter < (size - 1); counter++) {
-		const uint8_t index_next = (index + 1) % size;
+	for (uint16_t counter = 0; counter < (size - 1); counter++) {
+		const uint16_t index_next = (index + 1) % size;
 		outputVert &current_state = _output_vert_buffer[index];
 		outputVert &next_state = _output_vert_buffer[index_next];
 
@@ -383,7 +383,7 @@ void OutputPredictor::applyCorrectionToVerticalOutputBuffer(float vert_vel_corre
 void OutputPredictor::applyCorrectionToOutputBuffer(const Vector3f &vel_correction, const Vector3f &pos_correction)
 {
 	// loop through the output filter state history and apply the corrections to the velocity and position states
-	for (uint8_t index = 0; index < _output_buffer.get_length(); index++) {
+	for (uint16_t index = 0; index < _output_buffer.get_length(); index++) {
 		// a constant velocity correction is applied
 		_output_buffer[index].vel += vel_correction;
 
@@ -80,7 +80,7 @@ public:
 
 	void print_status();
 
-	bool allocate(uint8_t size)
+	bool allocate(uint16_t size)
 	{
 		if (_output_buffer.allocate(size) && _output_vert_buffer.allocate(size)) {
 			reset();
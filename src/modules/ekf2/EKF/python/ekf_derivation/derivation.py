@@ -55,6 +55,7 @@ parser = argparse.ArgumentParser()
 
 parser.add_argument("--disable_mag", action='store_true', help="disable mag")
 parser.add_argument("--disable_wind", action='store_true', help="disable wind")
+parser.add_argument("--disable_terrain", action='store_true', help="disable terrain")
 
 # Read arguments from command line
 args = parser.parse_args()
@@ -79,6 +80,9 @@ if args.disable_mag:
 if args.disable_wind:
     del State["wind_vel"]
 
+if args.disable_terrain:
+    del State["terrain"]
+
 class IdxDof():
     def __init__(self, idx, dof):
         self.idx = idx
@@ -144,6 +148,9 @@ def predict_covariance(
     if args.disable_wind:
         del state_error["wind_vel"]
 
+    if args.disable_terrain:
+        del state_error["terrain"]
+
     # True state kinematics
     state_t = Values()
 
@@ -738,10 +745,13 @@ if not args.disable_wind:
     generate_px4_function(compute_wind_init_and_cov_from_wind_speed_and_direction, output_names=["wind", "P_wind"])
 
 generate_px4_function(compute_yaw_innov_var_and_h, output_names=["innov_var", "H"])
-generate_px4_function(compute_flow_xy_innov_var_and_hx, output_names=["innov_var", "H"])
-generate_px4_function(compute_flow_y_innov_var_and_h, output_names=["innov_var", "H"])
-generate_px4_function(compute_hagl_innov_var, output_names=["innov_var"])
-generate_px4_function(compute_hagl_h, output_names=["H"])
+
+if not args.disable_terrain:
+    generate_px4_function(compute_flow_xy_innov_var_and_hx, output_names=["innov_var", "H"])
+    generate_px4_function(compute_flow_y_innov_var_and_h, output_names=["innov_var", "H"])
+    generate_px4_function(compute_hagl_innov_var, output_names=["innov_var"])
+    generate_px4_function(compute_hagl_h, output_names=["H"])
+
 generate_px4_function(compute_gnss_yaw_pred_innov_var_and_h, output_names=["meas_pred", "innov_var", "H"])
 generate_px4_function(compute_gravity_xyz_innov_var_and_hx, output_names=["innov_var", "Hx"])
 generate_px4_function(compute_gravity_y_innov_var_and_h, output_names=["innov_var", "Hy"])
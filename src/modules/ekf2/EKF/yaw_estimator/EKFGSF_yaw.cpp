@@ -53,6 +53,10 @@ using math::Utilities::updateYawInRotMat;
 
 EKFGSF_yaw::EKFGSF_yaw()
 {
+	for (uint8_t model_index = 0; model_index < N_MODELS_EKFGSF; model_index++) {
+		ahrsSetRotMat(model_index, Dcmf());
+	}
+
 	reset();
 }
 
@@ -99,6 +103,14 @@ void EKFGSF_yaw::predict(const matrix::Vector3f &delta_ang, const float delta_an
 		}
 	}
 
+	// generate an attitude reference using IMU data
+	ahrsPredict(delta_ang, delta_ang_dt);
+
+	// we don't start running the EKF part of the algorithm until there are regular velocity observations
+	if (!_ekf_gsf_vel_fuse_started) {
+		return;
+	}
+
 	for (uint8_t model_index = 0; model_index < N_MODELS_EKFGSF; model_index ++) {
 		predictEKF(model_index, delta_ang, delta_ang_dt, delta_vel, delta_vel_dt, in_air);
 	}
@@ -178,55 +190,98 @@ void EKFGSF_yaw::fuseVelocity(const Vector2f &vel_NE, const float vel_accuracy,
 	}
 }
 
-void EKFGSF_yaw::ahrsPredict(const uint8_t model_index, const Vector3f &delta_ang, const float delta_ang_dt)
+void EKFGSF_yaw::ahrsPredict(const Vector3f &delta_ang, const float delta_ang_dt)
 {
-	// generate attitude solution using simple complementary filter for the selected model
-	const Vector3f ang_rate = delta_ang / fmaxf(delta_ang_dt, 0.001f) - _ahrs_ekf_gsf[model_index].gyro_bias;
-
-	const Dcmf R_to_body = _ahrs_ekf_gsf[model_index].R.transpose();
-	const Vector3f gravity_direction_bf = R_to_body.col(2);
+	// generate attitude solution using simple complementary filter for all the models
+	const Vector3f ang_rate_meas = delta_ang / fmaxf(delta_ang_dt, 0.001f);
 
 	const float ahrs_accel_norm = _ahrs_accel.norm();
 
 	// gain from accel vector tilt error to rate gyro correction used by AHRS calculation
 	const float ahrs_accel_fusion_gain = ahrsCalcAccelGain();
 
-	// Perform angular rate correction using accel data and reduce correction as accel magnitude moves away from 1 g (reduces drift when vehicle picked up and moved).
+	// matrix::Vector3f::operator/() multiplies by the reciprocal, keep that rounding for the scalar code below
+	const float ahrs_accel_norm_inv = 1.f / ahrs_accel_norm;
+
 	// During fixed wing flight, compensate for centripetal acceleration assuming coordinated turns and X axis forward
-	Vector3f tilt_correction{};
+	const bool centripetal_accel_compensation_enabled = PX4_ISFINITE(_true_airspeed) && (_true_airspeed > FLT_EPSILON);
 
-	if (ahrs_accel_fusion_gain > 0.f) {
+	constexpr float gyro_bias_limit = 0.05f;
+	const float gyro_bias_gain_dt = _gyro_bias_gain * delta_ang_dt;
+
+	float delta_angle_corrected[3][N_MODELS_EKFGSF];
+
+	for (uint8_t model_index = 0; model_index < N_MODELS_EKFGSF; model_index++) {
+		float (&gyro_bias)[3][N_MODELS_EKFGSF] = _ahrs_ekf_gsf.gyro_bias;
+
+		const float ang_rate[3] {
+			ang_rate_meas(0) - gyro_bias[0][model_index],
+			ang_rate_meas(1) - gyro_bias[1][model_index],
+			ang_rate_meas(2) - gyro_bias[2][model_index]
+		};
+
+		// Perform angular rate correction using accel data and reduce correction as accel magnitude moves away from 1 g (reduces drift when vehicle picked up and moved).
+		float tilt_correction[3] {};
 
-		Vector3f accel = _ahrs_accel;
+		if (ahrs_accel_fusion_gain > 0.f) {
+			float accel[3] {_ahrs_accel(0), _ahrs_accel(1), _ahrs_accel(2)};
 
-		if (PX4_ISFINITE(_true_airspeed) && (_true_airspeed > FLT_EPSILON)) {
-			// Calculate body frame centripetal acceleration with assumption X axis is aligned with the airspeed vector
-			// Use cross product of body rate and body frame airspeed vector
-			const Vector3f centripetal_accel_bf = Vector3f(0.0f, _true_airspeed * ang_rate(2), - _true_airspeed * ang_rate(1));
+			if (centripetal_accel_compensation_enabled) {
+				// Calculate body frame centripetal acceleration with assumption X axis is aligned with the airspeed vector
+				// Use cross product of body rate and body frame airspeed vector
+				accel[1] -= _true_airspeed * ang_rate[2];
+				accel[2] -= -_true_airspeed * ang_rate[1];
+			}
+
+			// gravity direction in body frame is the last row of the body to earth frame rotation matrix
+			const float grav_x = _ahrs_ekf_gsf.R[2][0][model_index];
+			const float grav_y = _ahrs_ekf_gsf.R[2][1][model_index];
+			const float grav_z = _ahrs_ekf_gsf.R[2][2][model_index];
 
-			// correct measured accel for centripetal acceleration
-			accel -= centripetal_accel_bf;
+			tilt_correction[0] = (grav_y * accel[2] - grav_z * accel[1]) * ahrs_accel_fusion_gain * ahrs_accel_norm_inv;
+			tilt_correction[1] = (-grav_x * accel[2] + grav_z * accel[0]) * ahrs_accel_fusion_gain * ahrs_accel_norm_inv;
+			tilt_correction[2] = (grav_x * accel[1] - grav_y * accel[0]) * ahrs_accel_fusion_gain * ahrs_accel_norm_inv;
 		}
 
-		tilt_correction = (gravity_direction_bf % accel) * ahrs_accel_fusion_gain / ahrs_accel_norm;
+		// Gyro bias estimation
+		const float spin_rate = sqrtf(ang_rate[0] * ang_rate[0] + ang_rate[1] * ang_rate[1] + ang_rate[2] * ang_rate[2]);
+
+		for (uint8_t axis = 0; axis < 3; axis++) {
+			if (spin_rate < math::radians(10.f)) {
+				gyro_bias[axis][model_index] = math::constrain(gyro_bias[axis][model_index] - tilt_correction[axis] * gyro_bias_gain_dt,
+							       -gyro_bias_limit, gyro_bias_limit);
+			}
+
+			// delta angle from previous to current frame
+			delta_angle_corrected[axis][model_index] = delta_ang(axis)
+					+ (tilt_correction[axis] - gyro_bias[axis][model_index]) * delta_ang_dt;
+		}
 	}
 
-	// Gyro bias estimation
-	constexpr float gyro_bias_limit = 0.05f;
-	const float spin_rate = ang_rate.length();
+	// Apply delta angle to rotation matrix
+	ahrsPredictRotMat(delta_angle_corrected);
+}
 
-	if (spin_rate < math::radians(10.f)) {
-		_ahrs_ekf_gsf[model_index].gyro_bias -= tilt_correction * (_gyro_bias_gain * delta_ang_dt);
-		_ahrs_ekf_gsf[model_index].gyro_bias = matrix::constrain(_ahrs_ekf_gsf[model_index].gyro_bias,
-						       -gyro_bias_limit, gyro_bias_limit);
+Dcmf EKFGSF_yaw::ahrsGetRotMat(const uint8_t model_index) const
+{
+	Dcmf R;
+
+	for (uint8_t row = 0; row < 3; row++) {
+		for (uint8_t col = 0; col < 3; col++) {
+			R(row, col) = _ahrs_ekf_gsf.R[row][col][model_index];
+		}
 	}
 
-	// delta angle from previous to current frame
-	const Vector3f delta_angle_corrected = delta_ang
-					       + (tilt_correction - _ahrs_ekf_gsf[model_index].gyro_bias) * delta_ang_dt;
+	return R;
+}
 
-	// Apply delta angle to rotation matrix
-	_ahrs_ekf_gsf[model_index].R = ahrsPredictRotMat(_ahrs_ekf_gsf[model_index].R, delta_angle_corrected);
+void EKFGSF_yaw::ahrsSetRotMat(const uint8_t model_index, const Dcmf &R)
+{
+	for (uint8_t row = 0; row < 3; row++) {
+		for (uint8_t col = 0; col < 3; col++) {
+			_ahrs_ekf_gsf.R[row][col][model_index] = R(row, col);
+		}
+	}
 }
 
 void EKFGSF_yaw::ahrsAlignTilt(const Vector3f &delta_vel)
@@ -257,7 +312,7 @@ void EKFGSF_yaw::ahrsAlignTilt(const Vector3f &delta_vel)
 	R.setRow(2, down_in_bf);
 
 	for (uint8_t model_index = 0; model_index < N_MODELS_EKFGSF; model_index++) {
-		_ahrs_ekf_gsf[model_index].R = R;
+		ahrsSetRotMat(model_index, R);
 	}
 }
 
@@ -267,32 +322,26 @@ void EKFGSF_yaw::ahrsAlignYaw()
 	for (uint8_t model_index = 0; model_index < N_MODELS_EKFGSF; model_index++) {
 
 		const float yaw = wrap_pi(_ekf_gsf[model_index].X(2));
-		const Dcmf R = _ahrs_ekf_gsf[model_index].R;
-		_ahrs_ekf_gsf[model_index].R = updateYawInRotMat(yaw, R);
+		const Dcmf R = ahrsGetRotMat(model_index);
+		ahrsSetRotMat(model_index, updateYawInRotMat(yaw, R));
 	}
 }
 
 void EKFGSF_yaw::predictEKF(const uint8_t model_index, const Vector3f &delta_ang, const float delta_ang_dt,
 			    const Vector3f &delta_vel, const float delta_vel_dt, bool in_air)
 {
-	// generate an attitude reference using IMU data
-	ahrsPredict(model_index, delta_ang, delta_ang_dt);
-
-	// we don't start running the EKF part of the algorithm until there are regular velocity observations
-	if (!_ekf_gsf_vel_fuse_started) {
-		return;
-	}
+	const Dcmf R = ahrsGetRotMat(model_index);
 
 	// Calculate the yaw state using a projection onto the horizontal that avoids gimbal lock
-	_ekf_gsf[model_index].X(2) = getEulerYaw(_ahrs_ekf_gsf[model_index].R);
+	_ekf_gsf[model_index].X(2) = getEulerYaw(R);
 
 	// calculate delta velocity in a horizontal front-right frame
-	const Vector3f del_vel_NED = _ahrs_ekf_gsf[model_index].R * delta_vel;
+	const Vector3f del_vel_NED = R * delta_vel;
 	const float cos_yaw = cosf(_ekf_gsf[model_index].X(2));
 	const float sin_yaw = sinf(_ekf_gsf[model_index].X(2));
 	const float dvx =   del_vel_NED(0) * cos_yaw + del_vel_NED(1) * sin_yaw;
 	const float dvy = - del_vel_NED(0) * sin_yaw + del_vel_NED(1) * cos_yaw;
-	const float daz = Vector3f(_ahrs_ekf_gsf[model_index].R * delta_ang)(2);
+	const float daz = Vector3f(R * delta_ang)(2);
 
 	// delta velocity process noise double if we're not in air
 	const float accel_noise = in_air ? _accel_noise : 2.f * _accel_noise;
@@ -375,16 +424,13 @@ bool EKFGSF_yaw::updateEKF(const uint8_t model_index, const Vector2f &vel_NE, co
 	// take advantage of sparseness in the yaw rotation matrix
 	const float cosYaw = cosf(yawDelta);
 	const float sinYaw = sinf(yawDelta);
-	const float R_prev00 = _ahrs_ekf_gsf[model_index].R(0, 0);
-	const float R_prev01 = _ahrs_ekf_gsf[model_index].R(0, 1);
-	const float R_prev02 = _ahrs_ekf_gsf[model_index].R(0, 2);
+	auto &R = _ahrs_ekf_gsf.R;
 
-	_ahrs_ekf_gsf[model_index].R(0, 0) = R_prev00 * cosYaw - _ahrs_ekf_gsf[model_index].R(1, 0) * sinYaw;
-	_ahrs_ekf_gsf[model_index].R(0, 1) = R_prev01 * cosYaw - _ahrs_ekf_gsf[model_index].R(1, 1) * sinYaw;
-	_ahrs_ekf_gsf[model_index].R(0, 2) = R_prev02 * cosYaw - _ahrs_ekf_gsf[model_index].R(1, 2) * sinYaw;
-	_ahrs_ekf_gsf[model_index].R(1, 0) = R_prev00 * sinYaw + _ahrs_ekf_gsf[model_index].R(1, 0) * cosYaw;
-	_ahrs_ekf_gsf[model_index].R(1, 1) = R_prev01 * sinYaw + _ahrs_ekf_gsf[model_index].R(1, 1) * cosYaw;
-	_ahrs_ekf_gsf[model_index].R(1, 2) = R_prev02 * sinYaw + _ahrs_ekf_gsf[model_index].R(1, 2) * cosYaw;
+	for (uint8_t col = 0; col < 3; col++) {
+		const float R_prev0 = R[0][col][model_index];
+		R[0][col][model_index] = R_prev0 * cosYaw - R[1][col][model_index] * sinYaw;
+		R[1][col][model_index] = R_prev0 * sinYaw + R[1][col][model_index] * cosYaw;
+	}
 
 	return true;
 }
@@ -464,29 +510,29 @@ float EKFGSF_yaw::ahrsCalcAccelGain() const
 	return _tilt_gain * sq(1.f - math::min(attenuation * fabsf(delta_accel_g), 1.f));
 }
 
-Matrix3f EKFGSF_yaw::ahrsPredictRotMat(const Matrix3f &R, const Vector3f &g)
+void EKFGSF_yaw::ahrsPredictRotMat(const float g[3][N_MODELS_EKFGSF])
 {
-	Matrix3f ret = R;
-	ret(0, 0) += R(0, 1) * g(2) - R(0, 2) * g(1);
-	ret(0, 1) += R(0, 2) * g(0) - R(0, 0) * g(2);
-	ret(0, 2) += R(0, 0) * g(1) - R(0, 1) * g(0);
-	ret(1, 0) += R(1, 1) * g(2) - R(1, 2) * g(1);
-	ret(1, 1) += R(1, 2) * g(0) - R(1, 0) * g(2);
-	ret(1, 2) += R(1, 0) * g(1) - R(1, 1) * g(0);
-	ret(2, 0) += R(2, 1) * g(2) - R(2, 2) * g(1);
-	ret(2, 1) += R(2, 2) * g(0) - R(2, 0) * g(2);
-	ret(2, 2) += R(2, 0) * g(1) - R(2, 1) * g(0);
-
-	// Renormalise rows
+	auto &R = _ahrs_ekf_gsf.R;
+
 	for (uint8_t r = 0; r < 3; r++) {
-		const float rowLengthSq = ret.row(r).norm_squared();
+		for (uint8_t model_index = 0; model_index < N_MODELS_EKFGSF; model_index++) {
+			const float R0 = R[r][0][model_index];
+			const float R1 = R[r][1][model_index];
+			const float R2 = R[r][2][model_index];
+
+			const float ret0 = R0 + (R1 * g[2][model_index] - R2 * g[1][model_index]);
+			const float ret1 = R1 + (R2 * g[0][model_index] - R0 * g[2][model_index]);
+			const float ret2 = R2 + (R0 * g[1][model_index] - R1 * g[0][model_index]);
+
+			// Renormalise rows
+			const float rowLengthSq = ret0 * ret0 + ret1 * ret1 + ret2 * ret2;
 
-		if (rowLengthSq > FLT_EPSILON) {
 			// Use linear approximation for inverse sqrt taking advantage of the row length being close to 1.0
-			const float rowLengthInv = 1.5f - 0.5f * rowLengthSq;
-			ret.row(r) *= rowLengthInv;
+			const float rowLengthInv = (rowLengthSq > FLT_EPSILON) ? (1.5f - 0.5f * rowLengthSq) : 1.f;
+
+			R[r][0][model_index] = ret0 * rowLengthInv;
+			R[r][1][model_index] = ret1 * rowLengthInv;
+			R[r][2][model_index] = ret2 * rowLengthInv;
 		}
 	}
-
-	return ret;
 }
@@ -61,8 +61,10 @@ public:
 		// uncorrected rate gyro bias error about the gravity vector
 		if (!_ahrs_ekf_gsf_tilt_aligned || !_ekf_gsf_vel_fuse_started || force) {
 			// init gyro bias for each model
-			for (uint8_t model_index = 0; model_index < N_MODELS_EKFGSF; model_index++) {
-				_ahrs_ekf_gsf[model_index].gyro_bias = imu_gyro_bias;
+			for (uint8_t axis = 0; axis < 3; axis++) {
+				for (uint8_t model_index = 0; model_index < N_MODELS_EKFGSF; model_index++) {
+					_ahrs_ekf_gsf.gyro_bias[axis][model_index] = imu_gyro_bias(axis);
+				}
 			}
 		}
 	}
@@ -93,10 +95,12 @@ private:
 	// Declarations used by the bank of N_MODELS_EKFGSF AHRS complementary filters
 	float _true_airspeed{NAN};	// true airspeed used for centripetal accel compensation (m/s)
 
+	// The AHRS bank is stored as a structure of arrays with the model index as the inner dimension.
+	// Every model runs the same arithmetic on its own data, so the loops over models can be vectorised.
 	struct {
-		matrix::Dcmf R{matrix::eye<float, 3>()}; // matrix that rotates a vector from body to earth frame
-		matrix::Vector3f gyro_bias{};            // gyro bias learned and used by the quaternion calculation
-	} _ahrs_ekf_gsf[N_MODELS_EKFGSF] {};
+		float R[3][3][N_MODELS_EKFGSF];      // matrices that rotate a vector from body to earth frame
+		float gyro_bias[3][N_MODELS_EKFGSF]; // gyro bias learned and used by the quaternion calculation
+	} _ahrs_ekf_gsf{};
 
 	bool _ahrs_ekf_gsf_tilt_aligned{false};  // true the initial tilt alignment has been calculated
 	matrix::Vector3f _ahrs_accel{0.f, 0.f, 0.f};     // low pass filtered body frame specific force vector used by AHRS calculation (m/s/s)
@@ -104,8 +108,12 @@ private:
 	// calculate the gain from gravity vector misalingment to tilt correction to be used by all AHRS filters
 	float ahrsCalcAccelGain() const;
 
-	// update specified AHRS rotation matrix using IMU and optionally true airspeed data
-	void ahrsPredict(const uint8_t model_index, const matrix::Vector3f &delta_ang, const float delta_ang_dt);
+	// update all AHRS rotation matrices using IMU and optionally true airspeed data
+	void ahrsPredict(const matrix::Vector3f &delta_ang, const float delta_ang_dt);
+
+	// get/set the AHRS rotation matrix of the specified model
+	matrix::Dcmf ahrsGetRotMat(const uint8_t model_index) const;
+	void ahrsSetRotMat(const uint8_t model_index, const matrix::Dcmf &R);
 
 	// align all AHRS roll and pitch orientations using IMU delta velocity vector
 	void ahrsAlignTilt(const matrix::Vector3f &delta_vel);
@@ -113,8 +121,8 @@ private:
 	// align all AHRS yaw orientations to initial values
 	void ahrsAlignYaw();
 
-	// Efficient propagation of a delta angle in body frame applied to the body to earth frame rotation matrix
-	matrix::Matrix3f ahrsPredictRotMat(const matrix::Matrix3f &R, const matrix::Vector3f &g);
+	// Efficient propagation of the delta angles in body frame applied to all the body to earth frame rotation matrices
+	void ahrsPredictRotMat(const float g[3][N_MODELS_EKFGSF]);
 
 	// Declarations used by a bank of N_MODELS_EKFGSF EKFs
 
@@ -64,6 +64,7 @@ EKF2::EKF2(bool multi_mode, const px4::wq_config_t &config, bool replay_mode):
 #endif // CONFIG_EKF2_WIND
 	_params(_ekf.getParamHandle()),
 	_param_ekf2_predict_us(_params->filter_update_interval_us),
+	_param_ekf2_smooth_lag(_params->smoother_lag),
 	_param_ekf2_delay_max(_params->delay_max_ms),
 	_param_ekf2_imu_ctrl(_params->imu_ctrl),
 #if defined(CONFIG_EKF2_AUXVEL)
@@ -219,8 +220,13 @@ EKF2::EKF2(bool multi_mode, const px4::wq_config_t &config, bool replay_mode):
 
 EKF2::~EKF2()
 {
+#if defined(CONFIG_EKF2_MULTI_INSTANCE)
+	EKF2ImuFrontEnd::release(_imu_front_end);
+#endif // CONFIG_EKF2_MULTI_INSTANCE
+
 	perf_free(_ekf_update_perf);
 	perf_free(_msg_missed_imu_perf);
+	perf_free(_smoother_perf);
 }
 
 void EKF2::AdvertiseTopics()
@@ -237,6 +243,9 @@ void EKF2::AdvertiseTopics()
 		// only force advertise these in multi mode to ensure consistent uORB instance numbering
 		_global_position_pub.advertise();
 		_odometry_pub.advertise();
+#if defined(CONFIG_EKF2_MULTI_INSTANCE)
+		_estimator_health_pub.advertise();
+#endif // CONFIG_EKF2_MULTI_INSTANCE
 
 #if defined(CONFIG_EKF2_WIND)
 		_wind_pub.advertise();
@@ -252,6 +261,10 @@ void EKF2::AdvertiseTopics()
 
 #endif // CONFIG_EKF2_GNSS
 
+	if (_param_ekf2_smooth_lag.get() > 0) {
+		_estimator_smoothed_trajectory_pub.advertise();
+	}
+
 	// verbose logging
 	if (_param_ekf2_log_verbose.get()) {
 		_estimator_innovation_test_ratios_pub.advertise();
@@ -383,6 +396,17 @@ bool EKF2::multi_init(int imu, int mag)
 {
 	bool changed_instance = _vehicle_imu_sub.ChangeInstance(imu);
 
+	if (_imu_front_end == nullptr) {
+		_imu_front_end = EKF2ImuFrontEnd::acquire(imu);
+
+		if (_imu_front_end == nullptr) {
+			PX4_ERR("IMU %d front-end allocation failed", imu);
+			return false;
+		}
+
+		_imu_front_end_cursor = _imu_front_end->cursor();
+	}
+
 #if defined(CONFIG_EKF2_MAGNETOMETER)
 
 	if (!_magnetometer_sub.ChangeInstance(mag)) {
@@ -396,9 +420,11 @@ bool EKF2::multi_init(int imu, int mag)
 	if ((status_instance >= 0) && changed_instance
 	    && (_attitude_pub.get_instance() == status_instance)
 	    && (_local_position_pub.get_instance() == status_instance)
-	    && (_global_position_pub.get_instance() == status_instance)) {
+	    && (_global_position_pub.get_instance() == status_instance)
+	    && (_estimator_health_pub.get_instance() == status_instance)) {
 
 		_instance = status_instance;
+		_output_forwarder.set_instance(_instance);
 
 		ScheduleNow();
 		return true;
@@ -420,6 +446,24 @@ int EKF2::print_status(bool verbose)
 	perf_print_counter(_ekf_update_perf);
 	perf_print_counter(_msg_missed_imu_perf);
 
+	if (_ekf.smoother().enabled()) {
+		perf_print_counter(_smoother_perf);
+	}
+
+	if (_diag_stats_start != 0) {
+		const float dt = hrt_elapsed_time(&_diag_stats_start) * 1e-6f;
+
+		if (dt > 0.f) {
+			PX4_INFO_RAW("ekf2:%d diagnostics: published %.1f B/s, suppressed %.1f B/s\n", _instance,
+				     (double)(_diag_bytes_published / dt), (double)(_diag_bytes_suppressed / dt));
+		}
+	}
+
+	if (_param_ekf2_cpu_budget.get() > 0.f) {
+		PX4_INFO_RAW("ekf2:%d filter update period: %" PRId32 " us, CPU load %.1f%% (budget %.1f%%)\n", _instance,
+			     _params->filter_update_interval_us, (double)_cpu_load, (double)_param_ekf2_cpu_budget.get());
+	}
+
 	if (verbose) {
 #if defined(CONFIG_EKF2_VERBOSE_STATUS)
 		_ekf.print_status();
@@ -438,6 +482,8 @@ void EKF2::Run()
 		return;
 	}
 
+	const hrt_abstime run_start = hrt_absolute_time();
+
 	// check for parameter updates
 	if (_parameter_update_sub.updated() || !_callback_registered) {
 		// clear update
@@ -447,6 +493,17 @@ void EKF2::Run()
 		// update parameters from storage
 		updateParams();
 
+		// EKF2_PREDICT_US is the fastest rate, keep the period adapted to the CPU budget on top of it
+		_filter_update_interval_param_us = _params->filter_update_interval_us;
+
+		if ((_filter_update_interval_us > 0) && (_param_ekf2_cpu_budget.get() > 0.f)) {
+			_params->filter_update_interval_us = math::constrain(_filter_update_interval_us, _filter_update_interval_param_us,
+							     math::max(_filter_update_interval_param_us, _param_ekf2_predict_max.get()));
+
+		} else {
+			_filter_update_interval_us = 0;
+		}
+
 		VerifyParams();
 
 		// force advertise topics immediately for logging (EKF2_LOG_VERBOSE, per aid source control)
@@ -584,28 +641,19 @@ void EKF2::Run()
 #if defined(CONFIG_EKF2_MULTI_INSTANCE)
 
 	if (_multi_mode) {
-		const unsigned last_generation = _vehicle_imu_sub.get_last_generation();
-		vehicle_imu_s imu;
-		imu_updated = _vehicle_imu_sub.update(&imu);
+		// IMU data is converted once by the front-end shared with the other instances using this IMU
+		EKF2ImuFrontEnd::Sample imu;
+		bool imu_missed = false;
+		imu_updated = _imu_front_end->get(_imu_front_end_cursor, imu, imu_missed);
 
-		if (imu_updated && (_vehicle_imu_sub.get_last_generation() != last_generation + 1)) {
+		if (imu_missed) {
 			perf_count(_msg_missed_imu_perf);
+			_cpu_window_imu_missed++;
 		}
 
 		if (imu_updated) {
-			imu_sample_new.time_us = imu.timestamp_sample;
-			imu_sample_new.delta_ang_dt = imu.delta_angle_dt * 1.e-6f;
-			imu_sample_new.delta_ang = Vector3f{imu.delta_angle};
-			imu_sample_new.delta_vel_dt = imu.delta_velocity_dt * 1.e-6f;
-			imu_sample_new.delta_vel = Vector3f{imu.delta_velocity};
-
-			if (imu.delta_velocity_clipping > 0) {
-				imu_sample_new.delta_vel_clipping[0] = imu.delta_velocity_clipping & vehicle_imu_s::CLIPPING_X;
-				imu_sample_new.delta_vel_clipping[1] = imu.delta_velocity_clipping & vehicle_imu_s::CLIPPING_Y;
-				imu_sample_new.delta_vel_clipping[2] = imu.delta_velocity_clipping & vehicle_imu_s::CLIPPING_Z;
-			}
-
-			imu_dt = imu.delta_angle_dt;
+			imu_sample_new = imu.imu;
+			imu_dt = imu.delta_angle_dt_us;
 
 			if ((_device_id_accel == 0) || (_device_id_gyro == 0)) {
 				_device_id_accel = imu.accel_device_id;
@@ -651,6 +699,7 @@ void EKF2::Run()
 
 		if (imu_updated && (_sensor_combined_sub.get_last_generation() != last_generation + 1)) {
 			perf_count(_msg_missed_imu_perf);
+			_cpu_window_imu_missed++;
 		}
 
 		if (imu_updated) {
@@ -794,10 +843,13 @@ void EKF2::Run()
 
 			if (_param_ekf2_log_verbose.get()) {
 				PublishAidSourceStatus(now);
-				PublishInnovations(now);
-				PublishInnovationTestRatios(now);
-				PublishInnovationVariances(now);
-				PublishStates(now);
+
+				if (DiagnosticsBudgetAvailable(now)) {
+					PublishInnovations(now);
+					PublishInnovationTestRatios(now);
+					PublishInnovationVariances(now);
+					PublishStates(now);
+				}
 
 #if defined(CONFIG_EKF2_BAROMETER)
 				PublishBaroBias(now);
@@ -822,6 +874,9 @@ void EKF2::Run()
 			PublishOpticalFlowVel(now);
 #endif // CONFIG_EKF2_OPTICAL_FLOW
 
+			// after all real-time outputs have been published
+			PublishSmoothedTrajectory(now);
+
 			UpdateAccelCalibration(now);
 			UpdateGyroCalibration(now);
 #if defined(CONFIG_EKF2_MAGNETOMETER)
@@ -831,6 +886,8 @@ void EKF2::Run()
 
 		// publish ekf2_timestamps
 		_ekf2_timestamps_pub.publish(ekf2_timestamps);
+
+		UpdateFilterUpdateRate(run_start, imu_dt);
 	}
 
 	// re-schedule as backup timeout
@@ -938,6 +995,115 @@ void EKF2::VerifyParams()
 	}
 }
 
+bool EKF2::DiagnosticsBudgetAvailable(const hrt_abstime &timestamp)
+{
+	// innovations, test ratios, innovation variances and states
+	static constexpr uint32_t kDiagnosticsBytes = 3 * sizeof(estimator_innovations_s) + sizeof(estimator_states_s);
+
+	if (_diag_stats_start == 0) {
+		_diag_stats_start = hrt_absolute_time();
+	}
+
+	const int32_t budget = _param_ekf2_diag_budget.get(); // B/s
+
+	if (budget > 0) {
+		const hrt_abstime interval_us = (uint64_t)kDiagnosticsBytes * 1'000'000 / budget;
+
+		if ((_diag_publish_last != 0) && (timestamp < _diag_publish_last + interval_us)) {
+			_diag_bytes_suppressed += kDiagnosticsBytes;
+			return false;
+		}
+	}
+
+	if (!DiagnosticSubscribed(_estimator_innovations_pub) && !DiagnosticSubscribed(_estimator_innovation_test_ratios_pub)
+	    && !DiagnosticSubscribed(_estimator_innovation_variances_pub) && !DiagnosticSubscribed(_estimator_states_pub)) {
+		_diag_bytes_suppressed += kDiagnosticsBytes;
+		return false;
+	}
+
+	_diag_publish_last = timestamp;
+	_diag_bytes_published += kDiagnosticsBytes;
+	return true;
+}
+
+void EKF2::UpdateFilterUpdateRate(const hrt_abstime &run_start, uint32_t imu_dt_us)
+{
+	static constexpr hrt_abstime kWindow = 1_s;
+
+	// only speed up if the expected load stays below this fraction of the budget
+	static constexpr float kSpeedUpHysteresis = 0.8f;
+
+	const float budget = _param_ekf2_cpu_budget.get(); // percent of one core
+
+	if (budget <= 0.f) {
+		return;
+	}
+
+	const hrt_abstime now = hrt_absolute_time();
+
+	if (_cpu_window_start == 0) {
+		_cpu_window_start = run_start;
+	}
+
+	_cpu_window_run_time_us += now - run_start;
+	_cpu_window_imu_samples++;
+	_cpu_window_imu_dt_us += imu_dt_us;
+
+	if (now < _cpu_window_start + kWindow) {
+		return;
+	}
+
+	_cpu_load = 100.f * _cpu_window_run_time_us / (now - _cpu_window_start);
+
+	// the period is changed by one IMU sample per filter update at a time
+	const int32_t imu_interval_us = math::max((int32_t)(_cpu_window_imu_dt_us / _cpu_window_imu_samples), (int32_t)1);
+	const int32_t interval_min = _filter_update_interval_param_us;
+	const int32_t interval_max = math::max(interval_min, _param_ekf2_predict_max.get());
+	const int32_t interval = _params->filter_update_interval_us;
+	const int32_t ratio = math::max((int32_t)roundf((float)interval / imu_interval_us), (int32_t)1);
+
+	int32_t interval_new = interval;
+
+	if ((_cpu_load > budget) || (_cpu_window_imu_missed > 0)) {
+		// over budget, or the work queue didn't keep up with the IMU
+		if ((ratio + 1) * imu_interval_us <= interval_max) {
+			interval_new = (ratio + 1) * imu_interval_us;
+		}
+
+	} else if ((interval > interval_min) && (ratio > 1)) {
+		// load expected one IMU sample per filter update faster, assuming it scales with the filter update rate
+		const float cpu_load_faster = _cpu_load * ratio / (ratio - 1);
+
+		if (cpu_load_faster < kSpeedUpHysteresis * budget) {
+			interval_new = math::max((ratio - 1) * imu_interval_us, interval_min);
+		}
+	}
+
+	if (interval_new != interval) {
+		estimator_update_rate_s estimator_update_rate{};
+		estimator_update_rate.filter_update_interval_us = interval_new;
+		estimator_update_rate.filter_update_interval_us_prev = interval;
+		estimator_update_rate.cpu_load = _cpu_load;
+		estimator_update_rate.cpu_budget = budget;
+		estimator_update_rate.imu_samples_missed = _cpu_window_imu_missed;
+		estimator_update_rate.timestamp = hrt_absolute_time();
+		_estimator_update_rate_pub.publish(estimator_update_rate);
+
+		PX4_DEBUG("%d - filter update period %" PRId32 " -> %" PRId32 " us (CPU load %.1f%%)", _instance, interval,
+			  interval_new, (double)_cpu_load);
+
+		// picked up by the IMU down sampler on its next reset
+		_params->filter_update_interval_us = interval_new;
+		_filter_update_interval_us = interval_new;
+	}
+
+	_cpu_window_start = now;
+	_cpu_window_run_time_us = 0;
+	_cpu_window_imu_samples = 0;
+	_cpu_window_imu_missed = 0;
+	_cpu_window_imu_dt_us = 0;
+}
+
 void EKF2::PublishAidSourceStatus(const hrt_abstime &timestamp)
 {
 #if defined(CONFIG_EKF2_AIRSPEED)
@@ -1018,6 +1184,14 @@ void EKF2::PublishAttitude(const hrt_abstime &timestamp)
 		att.timestamp = _replay_mode ? timestamp : hrt_absolute_time();
 		_attitude_pub.publish(att);
 
+#if defined(CONFIG_EKF2_MULTI_INSTANCE)
+
+		if (_multi_mode) {
+			_output_forwarder.publish(att);
+		}
+
+#endif // CONFIG_EKF2_MULTI_INSTANCE
+
 	}  else if (_replay_mode) {
 		// in replay mode we have to tell the replay module not to wait for an update
 		// we do this by publishing an attitude with zero timestamp
@@ -1213,6 +1387,14 @@ void EKF2::PublishGlobalPosition(const hrt_abstime &timestamp)
 
 		global_pos.timestamp = _replay_mode ? timestamp : hrt_absolute_time();
 		_global_position_pub.publish(global_pos);
+
+#if defined(CONFIG_EKF2_MULTI_INSTANCE)
+
+		if (_multi_mode) {
+			_output_forwarder.publish(global_pos);
+		}
+
+#endif // CONFIG_EKF2_MULTI_INSTANCE
 	}
 }
 
@@ -1649,6 +1831,14 @@ void EKF2::PublishLocalPosition(const hrt_abstime &timestamp)
 	// publish vehicle local position data
 	lpos.timestamp = _replay_mode ? timestamp : hrt_absolute_time();
 	_local_position_pub.publish(lpos);
+
+#if defined(CONFIG_EKF2_MULTI_INSTANCE)
+
+	if (_multi_mode) {
+		_output_forwarder.publish(lpos);
+	}
+
+#endif // CONFIG_EKF2_MULTI_INSTANCE
 }
 
 void EKF2::PublishOdometry(const hrt_abstime &timestamp, const imuSample &imu_sample)
@@ -1691,6 +1881,14 @@ void EKF2::PublishOdometry(const hrt_abstime &timestamp, const imuSample &imu_sa
 	// publish vehicle odometry data
 	odom.timestamp = _replay_mode ? timestamp : hrt_absolute_time();
 	_odometry_pub.publish(odom);
+
+#if defined(CONFIG_EKF2_MULTI_INSTANCE)
+
+	if (_multi_mode) {
+		_output_forwarder.publish(odom);
+	}
+
+#endif // CONFIG_EKF2_MULTI_INSTANCE
 }
 
 void EKF2::PublishSensorBias(const hrt_abstime &timestamp)
@@ -1775,6 +1973,33 @@ void EKF2::PublishStates(const hrt_abstime &timestamp)
 	_estimator_states_pub.publish(states);
 }
 
+void EKF2::PublishSmoothedTrajectory(const hrt_abstime &timestamp)
+{
+	FixedLagSmoother &smoother = _ekf.smoother();
+
+	if (!smoother.enabled() || !DiagnosticSubscribed(_estimator_smoothed_trajectory_pub)) {
+		return;
+	}
+
+	perf_begin(_smoother_perf);
+	const bool smoothed = smoother.smooth();
+	perf_end(_smoother_perf);
+
+	if (smoothed) {
+		const FixedLagSmoother::Output &out = smoother.output();
+
+		estimator_smoothed_trajectory_s trajectory;
+		trajectory.timestamp_sample = out.time_us;
+		out.pos.copyTo(trajectory.position);
+		out.vel.copyTo(trajectory.velocity);
+		out.pos_var.copyTo(trajectory.position_variance);
+		out.vel_var.copyTo(trajectory.velocity_variance);
+		trajectory.lag = smoother.lagTime();
+		trajectory.timestamp = _replay_mode ? timestamp : hrt_absolute_time();
+		_estimator_smoothed_trajectory_pub.publish(trajectory);
+	}
+}
+
 void EKF2::PublishStatus(const hrt_abstime &timestamp)
 {
 	estimator_status_s status{};
@@ -1851,6 +2076,26 @@ void EKF2::PublishStatus(const hrt_abstime &timestamp)
 
 	status.timestamp = _replay_mode ? timestamp : hrt_absolute_time();
 	_estimator_status_pub.publish(status);
+
+#if defined(CONFIG_EKF2_MULTI_INSTANCE)
+
+	if (_multi_mode) {
+		// compact summary for the selector
+		estimator_health_s health;
+		health.timestamp_sample = status.timestamp_sample;
+		health.accel_device_id = status.accel_device_id;
+		health.gyro_device_id = status.gyro_device_id;
+		health.baro_device_id = status.baro_device_id;
+		health.mag_device_id = status.mag_device_id;
+		health.vel_test_ratio = status.vel_test_ratio;
+		health.pos_test_ratio = status.pos_test_ratio;
+		health.hgt_test_ratio = status.hgt_test_ratio;
+		health.filter_fault_flags = status.filter_fault_flags;
+		health.timestamp = status.timestamp;
+		_estimator_health_pub.publish(health);
+	}
+
+#endif // CONFIG_EKF2_MULTI_INSTANCE
 }
 
 void EKF2::PublishStatusFlags(const hrt_abstime &timestamp)
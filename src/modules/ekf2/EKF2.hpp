@@ -43,6 +43,8 @@
 
 #include "EKF/ekf.h"
 
+#include "EKF2ImuFrontEnd.hpp"
+#include "EKF2OutputForwarder.hpp"
 #include "EKF2Selector.hpp"
 
 #include <float.h>
@@ -67,11 +69,14 @@
 #include <uORB/topics/estimator_bias.h>
 #include <uORB/topics/estimator_bias3d.h>
 #include <uORB/topics/estimator_event_flags.h>
+#include <uORB/topics/estimator_health.h>
 #include <uORB/topics/estimator_innovations.h>
 #include <uORB/topics/estimator_sensor_bias.h>
+#include <uORB/topics/estimator_smoothed_trajectory.h>
 #include <uORB/topics/estimator_states.h>
 #include <uORB/topics/estimator_status.h>
 #include <uORB/topics/estimator_status_flags.h>
+#include <uORB/topics/estimator_update_rate.h>
 #include <uORB/topics/parameter_update.h>
 #include <uORB/topics/sensor_combined.h>
 #include <uORB/topics/sensor_selection.h>
@@ -157,7 +162,7 @@ public:
 
 private:
 
-	static constexpr uint8_t MAX_NUM_IMUS = 4;
+	static constexpr uint8_t MAX_NUM_IMUS = EKF2ImuFrontEnd::MAX_NUM_IMUS;
 	static constexpr uint8_t MAX_NUM_MAGS = 4;
 
 	void Run() override;
@@ -189,6 +194,7 @@ private:
 	void PublishLocalPosition(const hrt_abstime &timestamp);
 	void PublishOdometry(const hrt_abstime &timestamp, const imuSample &imu_sample);
 	void PublishSensorBias(const hrt_abstime &timestamp);
+	void PublishSmoothedTrajectory(const hrt_abstime &timestamp);
 	void PublishStates(const hrt_abstime &timestamp);
 	void PublishStatus(const hrt_abstime &timestamp);
 	void PublishStatusFlags(const hrt_abstime &timestamp);
@@ -253,17 +259,49 @@ private:
 	void PublishAidSourceStatus(const T &status, hrt_abstime &status_publish_last, uORB::PublicationMulti<T> &pub)
 	{
 		if (status.timestamp_sample > status_publish_last) {
-			// publish if updated
-			T status_out{status};
-			status_out.estimator_instance = _instance;
-			status_out.timestamp = hrt_absolute_time();
-			pub.publish(status_out);
+			// publish if updated (fusion attempted) and someone is listening
+			if (DiagnosticSubscribed(pub)) {
+				T status_out{status};
+				status_out.estimator_instance = _instance;
+				status_out.timestamp = hrt_absolute_time();
+				pub.publish(status_out);
+
+				_diag_bytes_published += sizeof(T);
+
+			} else {
+				_diag_bytes_suppressed += sizeof(T);
+			}
 
 			// record timestamp sample
 			status_publish_last = status.timestamp_sample;
 		}
 	}
 
+	/**
+	 * Diagnostic topics are only published if they have a subscriber (logger, mavlink, ...). The first
+	 * publication is always done so that the topic exists for subscribers that start later.
+	 * In replay mode everything is published to keep the output independent of the subscribers.
+	 */
+	template <typename T>
+	bool DiagnosticSubscribed(const uORB::PublicationMulti<T> &pub) const
+	{
+		return _replay_mode || !pub.advertised() || (pub.subscriber_count() > 0);
+	}
+
+	/**
+	 * Large diagnostic topics (innovations, test ratios, innovation variances and states) are decimated
+	 * so that they stay within the EKF2_DIAG_BUDGET bandwidth budget.
+	 */
+	bool DiagnosticsBudgetAvailable(const hrt_abstime &timestamp);
+
+	/*
+	 * Adapt the filter update period (IMU downsampling ratio) to the EKF2_CPU_BUDGET CPU budget, between
+	 * EKF2_PREDICT_US and EKF2_PREDICT_MAX. Every change is published on estimator_update_rate.
+	 * @param run_start start time of this Run() cycle
+	 * @param imu_dt_us IMU sample interval
+	 */
+	void UpdateFilterUpdateRate(const hrt_abstime &run_start, uint32_t imu_dt_us);
+
 	static constexpr float sq(float x) { return x * x; };
 
 	const bool _replay_mode{false};			///< true when we use replay data from a log
@@ -277,8 +315,25 @@ private:
 	uint64_t _start_time_us = 0;		///< system time at EKF start (uSec)
 	int64_t _last_time_slip_us = 0;		///< Last time slip (uSec)
 
+	// diagnostics publication policy
+	hrt_abstime _diag_publish_last{0};		///< last publication of the large diagnostic topics
+	hrt_abstime _diag_stats_start{0};
+	uint64_t _diag_bytes_published{0};
+	uint64_t _diag_bytes_suppressed{0};
+
+	// filter update rate adaptation to the CPU budget
+	hrt_abstime _cpu_window_start{0};
+	hrt_abstime _cpu_window_run_time_us{0};	///< execution time of Run() in the current window
+	uint32_t _cpu_window_imu_samples{0};
+	uint32_t _cpu_window_imu_missed{0};
+	uint32_t _cpu_window_imu_dt_us{0};		///< sum of the IMU sample intervals in the current window
+	int32_t _filter_update_interval_us{0};		///< adapted filter update period, 0 if not adapted
+	int32_t _filter_update_interval_param_us{0};	///< EKF2_PREDICT_US
+	float _cpu_load{0.f};				///< EKF2 execution time over the last window (percent of one core)
+
 	perf_counter_t _ekf_update_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": EKF update")};
 	perf_counter_t _msg_missed_imu_perf{perf_alloc(PC_COUNT, MODULE_NAME": IMU message missed")};
+	perf_counter_t _smoother_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": smoother")};
 
 	InFlightCalibration _accel_cal{};
 	InFlightCalibration _gyro_cal{};
@@ -395,6 +450,14 @@ private:
 	uORB::SubscriptionCallbackWorkItem _sensor_combined_sub{this, ORB_ID(sensor_combined)};
 	uORB::SubscriptionCallbackWorkItem _vehicle_imu_sub{this, ORB_ID(vehicle_imu)};
 
+#if defined(CONFIG_EKF2_MULTI_INSTANCE)
+	EKF2ImuFrontEnd *_imu_front_end {nullptr}; ///< shared with the other instances using the same IMU
+	uint32_t _imu_front_end_cursor{0};
+
+	EKF2OutputForwarder _output_forwarder{}; ///< vehicle outputs if this is the primary instance
+	uORB::PublicationMulti<estimator_health_s> _estimator_health_pub{ORB_ID(estimator_health)};
+#endif // CONFIG_EKF2_MULTI_INSTANCE
+
 #if defined(CONFIG_EKF2_RANGE_FINDER)
 	hrt_abstime _status_rng_hgt_pub_last {0};
 
@@ -425,9 +488,11 @@ private:
 	uORB::PublicationMulti<estimator_innovations_s>      _estimator_innovation_variances_pub{ORB_ID(estimator_innovation_variances)};
 	uORB::PublicationMulti<estimator_innovations_s>      _estimator_innovations_pub{ORB_ID(estimator_innovations)};
 	uORB::PublicationMulti<estimator_sensor_bias_s>      _estimator_sensor_bias_pub{ORB_ID(estimator_sensor_bias)};
+	uORB::PublicationMulti<estimator_smoothed_trajectory_s> _estimator_smoothed_trajectory_pub{ORB_ID(estimator_smoothed_trajectory)};
 	uORB::PublicationMulti<estimator_states_s>           _estimator_states_pub{ORB_ID(estimator_states)};
 	uORB::PublicationMulti<estimator_status_flags_s>     _estimator_status_flags_pub{ORB_ID(estimator_status_flags)};
 	uORB::PublicationMulti<estimator_status_s>           _estimator_status_pub{ORB_ID(estimator_status)};
+	uORB::PublicationMulti<estimator_update_rate_s>      _estimator_update_rate_pub{ORB_ID(estimator_update_rate)};
 
 	uORB::PublicationMulti<estimator_aid_source1d_s> _estimator_aid_src_fake_hgt_pub{ORB_ID(estimator_aid_src_fake_hgt)};
 	uORB::PublicationMulti<estimator_aid_source2d_s> _estimator_aid_src_fake_pos_pub{ORB_ID(estimator_aid_src_fake_pos)};
@@ -483,7 +548,11 @@ private:
 
 	DEFINE_PARAMETERS(
 		(ParamBool<px4::params::EKF2_LOG_VERBOSE>) _param_ekf2_log_verbose,
+		(ParamInt<px4::params::EKF2_DIAG_BUDGET>) _param_ekf2_diag_budget,
 		(ParamExtInt<px4::params::EKF2_PREDICT_US>) _param_ekf2_predict_us,
+		(ParamInt<px4::params::EKF2_PREDICT_MAX>) _param_ekf2_predict_max,
+		(ParamFloat<px4::params::EKF2_CPU_BUDGET>) _param_ekf2_cpu_budget,
+		(ParamExtInt<px4::params::EKF2_SMOOTH_LAG>) _param_ekf2_smooth_lag,
 		(ParamExtFloat<px4::params::EKF2_DELAY_MAX>) _param_ekf2_delay_max,
 		(ParamExtInt<px4::params::EKF2_IMU_CTRL>) _param_ekf2_imu_ctrl,
 
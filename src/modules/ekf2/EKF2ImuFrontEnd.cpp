@@ -0,0 +1,121 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include "EKF2ImuFrontEnd.hpp"
+
+using matrix::Vector3f;
+
+EKF2ImuFrontEnd *EKF2ImuFrontEnd::_front_ends[MAX_NUM_IMUS] {};
+
+EKF2ImuFrontEnd *EKF2ImuFrontEnd::acquire(uint8_t imu_instance)
+{
+	if (imu_instance >= MAX_NUM_IMUS) {
+		return nullptr;
+	}
+
+	if (_front_ends[imu_instance] == nullptr) {
+		_front_ends[imu_instance] = new EKF2ImuFrontEnd(imu_instance);
+
+		if (_front_ends[imu_instance] == nullptr) {
+			return nullptr;
+		}
+	}
+
+	_front_ends[imu_instance]->_ref_count++;
+	return _front_ends[imu_instance];
+}
+
+void EKF2ImuFrontEnd::release(EKF2ImuFrontEnd *front_end)
+{
+	if ((front_end == nullptr) || (front_end->_ref_count == 0)) {
+		return;
+	}
+
+	front_end->_ref_count--;
+
+	if (front_end->_ref_count == 0) {
+		_front_ends[front_end->_imu_instance] = nullptr;
+		delete front_end;
+	}
+}
+
+void EKF2ImuFrontEnd::poll()
+{
+	const unsigned last_generation = _vehicle_imu_sub.get_last_generation();
+	vehicle_imu_s imu;
+
+	if (!_vehicle_imu_sub.update(&imu)) {
+		return;
+	}
+
+	Sample &sample = _sample;
+	sample = {};
+
+	sample.imu.time_us = imu.timestamp_sample;
+	sample.imu.delta_ang_dt = imu.delta_angle_dt * 1.e-6f;
+	sample.imu.delta_ang = Vector3f{imu.delta_angle};
+	sample.imu.delta_vel_dt = imu.delta_velocity_dt * 1.e-6f;
+	sample.imu.delta_vel = Vector3f{imu.delta_velocity};
+
+	if (imu.delta_velocity_clipping > 0) {
+		sample.imu.delta_vel_clipping[0] = imu.delta_velocity_clipping & vehicle_imu_s::CLIPPING_X;
+		sample.imu.delta_vel_clipping[1] = imu.delta_velocity_clipping & vehicle_imu_s::CLIPPING_Y;
+		sample.imu.delta_vel_clipping[2] = imu.delta_velocity_clipping & vehicle_imu_s::CLIPPING_Z;
+	}
+
+	sample.accel_device_id = imu.accel_device_id;
+	sample.gyro_device_id = imu.gyro_device_id;
+	sample.delta_angle_dt_us = imu.delta_angle_dt;
+	sample.accel_calibration_count = imu.accel_calibration_count;
+	sample.gyro_calibration_count = imu.gyro_calibration_count;
+	sample.publication_missed = (_vehicle_imu_sub.get_last_generation() != last_generation + 1);
+
+	_sample_count++;
+}
+
+bool EKF2ImuFrontEnd::get(uint32_t &cursor, Sample &sample, bool &missed)
+{
+	poll();
+
+	if (cursor == _sample_count) {
+		missed = false;
+		return false;
+	}
+
+	missed = (_sample_count - cursor > 1) || _sample.publication_missed;
+	sample = _sample;
+	cursor = _sample_count;
+
+	return true;
+}
@@ -0,0 +1,110 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file EKF2ImuFrontEnd.hpp
+ * IMU front-end shared by the multi-instance EKF2 instances using the same IMU.
+ */
+
+#ifndef EKF2IMUFRONTEND_HPP
+#define EKF2IMUFRONTEND_HPP
+
+#include "EKF/common.h"
+
+#include <uORB/Subscription.hpp>
+#include <uORB/topics/vehicle_imu.h>
+
+/**
+ * With multi-instance EKF2 all the instances using a given IMU (one per magnetometer) run on the
+ * same work queue (px4::ins_instance_to_wq()). The front-end copies and converts each vehicle_imu
+ * publication only once. Like uORB::Subscription::update(), every instance receives the newest
+ * sample, samples it did not get to in time are counted as missed.
+ *
+ * Not thread-safe: must only be used from the work queue of the IMU instance.
+ */
+class EKF2ImuFrontEnd
+{
+public:
+	static constexpr uint8_t MAX_NUM_IMUS = 4;
+
+	struct Sample {
+		estimator::imuSample imu{};
+		uint32_t accel_device_id{0};
+		uint32_t gyro_device_id{0};
+		uint16_t delta_angle_dt_us{0};
+		uint8_t accel_calibration_count{0};
+		uint8_t gyro_calibration_count{0};
+		bool publication_missed{false}; ///< vehicle_imu publications were lost before this sample
+	};
+
+	/**
+	 * Get the front-end of an IMU instance, allocating it on first use.
+	 * Each successful acquire() must be matched by a release(). Must be called with the ekf2 module lock held.
+	 * @return nullptr on failure
+	 */
+	static EKF2ImuFrontEnd *acquire(uint8_t imu_instance);
+	static void release(EKF2ImuFrontEnd *front_end);
+
+	/**
+	 * Get the newest sample for a consumer.
+	 * @param cursor position of the consumer in the sample sequence, advanced to the returned sample
+	 * @param sample output sample
+	 * @param missed set if samples were lost, either upstream or because the consumer skipped samples
+	 * @return true if a new sample was returned
+	 */
+	bool get(uint32_t &cursor, Sample &sample, bool &missed);
+
+	/**
+	 * Cursor for a new consumer, starting at the next sample.
+	 */
+	uint32_t cursor() const { return _sample_count; }
+
+private:
+	explicit EKF2ImuFrontEnd(uint8_t imu_instance) : _vehicle_imu_sub{ORB_ID(vehicle_imu), imu_instance}, _imu_instance(imu_instance) {}
+	~EKF2ImuFrontEnd() = default;
+
+	void poll();
+
+	static EKF2ImuFrontEnd *_front_ends[MAX_NUM_IMUS];
+
+	uORB::Subscription _vehicle_imu_sub;
+
+	Sample _sample{};
+	uint32_t _sample_count{0}; ///< total number of samples received since start
+
+	const uint8_t _imu_instance;
+	uint8_t _ref_count{0};
+};
+
+#endif // !EKF2IMUFRONTEND_HPP
@@ -0,0 +1,359 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include "EKF2OutputForwarder.hpp"
+
+using matrix::Quatf;
+using matrix::Vector2f;
+
+bool EKF2OutputForwarder::updatePrimary()
+{
+	if (_estimator_selector_status_sub.updated()) {
+		estimator_selector_status_s estimator_selector_status;
+
+		if (_estimator_selector_status_sub.copy(&estimator_selector_status)) {
+			const bool primary = (estimator_selector_status.primary_instance == _instance);
+
+			if (primary && !_primary) {
+				// continue from the outputs last published by the previous primary
+				_attitude_takeover = true;
+				_local_position_takeover = true;
+				_global_position_takeover = true;
+				_odometry_takeover = true;
+			}
+
+			_primary = primary;
+		}
+	}
+
+	return _primary;
+}
+
+void EKF2OutputForwarder::publish(const vehicle_attitude_s &estimator_attitude)
+{
+	if (!updatePrimary()) {
+		return;
+	}
+
+	vehicle_attitude_s attitude{estimator_attitude};
+	bool instance_change = false;
+
+	if (_attitude_takeover) {
+		_attitude_takeover = false;
+
+		if (!_vehicle_attitude_sub.copy(&_attitude_last)) {
+			_attitude_last = {};
+		}
+
+		instance_change = (_attitude_last.timestamp != 0);
+		_quat_reset_counter = _attitude_last.quat_reset_counter;
+	}
+
+	if (_attitude_last.timestamp != 0) {
+		if (!instance_change && (attitude.quat_reset_counter == _attitude_last.quat_reset_counter + 1)) {
+			// propogate deltas from estimator data while maintaining the overall reset counts
+			++_quat_reset_counter;
+			_delta_q_reset = Quatf{attitude.delta_q_reset};
+
+		} else if (instance_change || (attitude.quat_reset_counter != _attitude_last.quat_reset_counter)) {
+			// on reset compute deltas from last published data
+			++_quat_reset_counter;
+			_delta_q_reset = (Quatf(attitude.q) * Quatf(_attitude_last.q).inversed()).normalized();
+		}
+
+	} else {
+		_quat_reset_counter = attitude.quat_reset_counter;
+		_delta_q_reset = Quatf{attitude.delta_q_reset};
+	}
+
+	// ensure monotonically increasing timestamp_sample through a primary change
+	const bool publish = (attitude.timestamp_sample > _attitude_last.timestamp_sample);
+
+	// save last estimator_attitude as published with original resets
+	_attitude_last = attitude;
+
+	if (publish) {
+		attitude.quat_reset_counter = _quat_reset_counter;
+		_delta_q_reset.copyTo(attitude.delta_q_reset);
+
+		_vehicle_attitude_pub.publish(attitude);
+	}
+}
+
+void EKF2OutputForwarder::publish(const vehicle_local_position_s &estimator_local_position)
+{
+	if (!updatePrimary()) {
+		return;
+	}
+
+	vehicle_local_position_s local_position{estimator_local_position};
+	bool instance_change = false;
+
+	if (_local_position_takeover) {
+		_local_position_takeover = false;
+
+		if (!_vehicle_local_position_sub.copy(&_local_position_last)) {
+			_local_position_last = {};
+		}
+
+		instance_change = (_local_position_last.timestamp != 0);
+
+		_xy_reset_counter = _local_position_last.xy_reset_counter;
+		_z_reset_counter = _local_position_last.z_reset_counter;
+		_vxy_reset_counter = _local_position_last.vxy_reset_counter;
+		_vz_reset_counter = _local_position_last.vz_reset_counter;
+		_heading_reset_counter = _local_position_last.heading_reset_counter;
+		_hagl_reset_counter = _local_position_last.dist_bottom_reset_counter;
+	}
+
+	if (_local_position_last.timestamp != 0) {
+		// XY reset
+		if (!instance_change && (local_position.xy_reset_counter == _local_position_last.xy_reset_counter + 1)) {
+			++_xy_reset_counter;
+			_delta_xy_reset = Vector2f{local_position.delta_xy};
+
+		} else if (instance_change || (local_position.xy_reset_counter != _local_position_last.xy_reset_counter)) {
+			++_xy_reset_counter;
+			_delta_xy_reset = Vector2f{local_position.x, local_position.y} - Vector2f{_local_position_last.x, _local_position_last.y};
+		}
+
+		// Z reset
+		if (!instance_change && (local_position.z_reset_counter == _local_position_last.z_reset_counter + 1)) {
+			++_z_reset_counter;
+			_delta_z_reset = local_position.delta_z;
+
+		} else if (instance_change || (local_position.z_reset_counter != _local_position_last.z_reset_counter)) {
+			++_z_reset_counter;
+			_delta_z_reset = local_position.z - _local_position_last.z;
+		}
+
+		// VXY reset
+		if (!instance_change && (local_position.vxy_reset_counter == _local_position_last.vxy_reset_counter + 1)) {
+			++_vxy_reset_counter;
+			_delta_vxy_reset = Vector2f{local_position.delta_vxy};
+
+		} else if (instance_change || (local_position.vxy_reset_counter != _local_position_last.vxy_reset_counter)) {
+			++_vxy_reset_counter;
+			_delta_vxy_reset = Vector2f{local_position.vx, local_position.vy} - Vector2f{_local_position_last.vx, _local_position_last.vy};
+		}
+
+		// VZ reset
+		if (!instance_change && (local_position.vz_reset_counter == _local_position_last.vz_reset_counter + 1)) {
+			++_vz_reset_counter;
+			_delta_vz_reset = local_position.delta_vz;
+
+		} else if (instance_change || (local_position.vz_reset_counter != _local_position_last.vz_reset_counter)) {
+			++_vz_reset_counter;
+			_delta_vz_reset = local_position.vz - _local_position_last.vz;
+		}
+
+		// heading reset
+		if (!instance_change && (local_position.heading_reset_counter == _local_position_last.heading_reset_counter + 1)) {
+			++_heading_reset_counter;
+			_delta_heading_reset = local_position.delta_heading;
+
+		} else if (instance_change || (local_position.heading_reset_counter != _local_position_last.heading_reset_counter)) {
+			++_heading_reset_counter;
+			_delta_heading_reset = matrix::wrap_pi(local_position.heading - _local_position_last.heading);
+		}
+
+		// HAGL (dist_bottom) reset
+		if (!instance_change
+		    && (local_position.dist_bottom_reset_counter == _local_position_last.dist_bottom_reset_counter + 1)) {
+			++_hagl_reset_counter;
+			_delta_hagl_reset = local_position.delta_dist_bottom;
+
+		} else if (instance_change
+			   || (local_position.dist_bottom_reset_counter != _local_position_last.dist_bottom_reset_counter)) {
+			++_hagl_reset_counter;
+			_delta_hagl_reset = local_position.dist_bottom - _local_position_last.dist_bottom;
+		}
+
+	} else {
+		_xy_reset_counter = local_position.xy_reset_counter;
+		_z_reset_counter = local_position.z_reset_counter;
+		_vxy_reset_counter = local_position.vxy_reset_counter;
+		_vz_reset_counter = local_position.vz_reset_counter;
+		_heading_reset_counter = local_position.heading_reset_counter;
+		_hagl_reset_counter = local_position.dist_bottom_reset_counter;
+
+		_delta_xy_reset = Vector2f{local_position.delta_xy};
+		_delta_z_reset = local_position.delta_z;
+		_delta_vxy_reset = Vector2f{local_position.delta_vxy};
+		_delta_vz_reset = local_position.delta_vz;
+		_delta_heading_reset = local_position.delta_heading;
+		_delta_hagl_reset = local_position.delta_dist_bottom;
+	}
+
+	// ensure monotonically increasing timestamp_sample through a primary change
+	const bool publish = (local_position.timestamp_sample > _local_position_last.timestamp_sample);
+
+	// save last estimator_local_position as published with original resets
+	_local_position_last = local_position;
+
+	if (publish) {
+		local_position.xy_reset_counter = _xy_reset_counter;
+		local_position.z_reset_counter = _z_reset_counter;
+		local_position.vxy_reset_counter = _vxy_reset_counter;
+		local_position.vz_reset_counter = _vz_reset_counter;
+		local_position.heading_reset_counter = _heading_reset_counter;
+		local_position.dist_bottom_reset_counter = _hagl_reset_counter;
+
+		_delta_xy_reset.copyTo(local_position.delta_xy);
+		local_position.delta_z = _delta_z_reset;
+		_delta_vxy_reset.copyTo(local_position.delta_vxy);
+		local_position.delta_vz = _delta_vz_reset;
+		local_position.delta_heading = _delta_heading_reset;
+		local_position.delta_dist_bottom = _delta_hagl_reset;
+
+		_vehicle_local_position_pub.publish(local_position);
+	}
+}
+
+void EKF2OutputForwarder::publish(const vehicle_global_position_s &estimator_global_position)
+{
+	if (!updatePrimary()) {
+		return;
+	}
+
+	vehicle_global_position_s global_position{estimator_global_position};
+	bool instance_change = false;
+
+	if (_global_position_takeover) {
+		_global_position_takeover = false;
+
+		if (!_vehicle_global_position_sub.copy(&_global_position_last)) {
+			_global_position_last = {};
+		}
+
+		instance_change = (_global_position_last.timestamp != 0);
+
+		_lat_lon_reset_counter = _global_position_last.lat_lon_reset_counter;
+		_alt_reset_counter = _global_position_last.alt_reset_counter;
+		_terrain_reset_counter = _global_position_last.terrain_reset_counter;
+	}
+
+	if (_global_position_last.timestamp != 0) {
+		// lat/lon reset
+		if (instance_change || (global_position.lat_lon_reset_counter != _global_position_last.lat_lon_reset_counter)) {
+			++_lat_lon_reset_counter;
+		}
+
+		// alt reset
+		if (!instance_change && (global_position.alt_reset_counter == _global_position_last.alt_reset_counter + 1)) {
+			++_alt_reset_counter;
+			_delta_alt_reset = global_position.delta_alt;
+
+		} else if (instance_change || (global_position.alt_reset_counter != _global_position_last.alt_reset_counter)) {
+			++_alt_reset_counter;
+			_delta_alt_reset = global_position.alt - _global_position_last.alt;
+		}
+
+		// terrain reset
+		if (!instance_change && (global_position.terrain_reset_counter == _global_position_last.terrain_reset_counter + 1)) {
+			++_terrain_reset_counter;
+			_delta_terrain_reset = global_position.delta_terrain;
+
+		} else if (instance_change || (global_position.terrain_reset_counter != _global_position_last.terrain_reset_counter)) {
+			++_terrain_reset_counter;
+			_delta_terrain_reset = global_position.terrain_alt - _global_position_last.terrain_alt;
+		}
+
+	} else {
+		_lat_lon_reset_counter = global_position.lat_lon_reset_counter;
+		_alt_reset_counter = global_position.alt_reset_counter;
+		_terrain_reset_counter = global_position.terrain_reset_counter;
+
+		_delta_alt_reset = global_position.delta_alt;
+		_delta_terrain_reset = global_position.delta_terrain;
+	}
+
+	// ensure monotonically increasing timestamp_sample through a primary change
+	const bool publish = (global_position.timestamp_sample > _global_position_last.timestamp_sample);
+
+	// save last estimator_global_position as published with original resets
+	_global_position_last = global_position;
+
+	if (publish) {
+		global_position.lat_lon_reset_counter = _lat_lon_reset_counter;
+		global_position.alt_reset_counter = _alt_reset_counter;
+		global_position.delta_alt = _delta_alt_reset;
+		global_position.terrain_reset_counter = _terrain_reset_counter;
+		global_position.delta_terrain = _delta_terrain_reset;
+
+		_vehicle_global_position_pub.publish(global_position);
+	}
+}
+
+void EKF2OutputForwarder::publish(const vehicle_odometry_s &estimator_odometry)
+{
+	if (!updatePrimary()) {
+		return;
+	}
+
+	vehicle_odometry_s odometry{estimator_odometry};
+	bool instance_change = false;
+
+	if (_odometry_takeover) {
+		_odometry_takeover = false;
+
+		if (!_vehicle_odometry_sub.copy(&_odometry_last)) {
+			_odometry_last = {};
+		}
+
+		instance_change = (_odometry_last.timestamp != 0);
+		_odometry_reset_counter = _odometry_last.reset_counter;
+	}
+
+	if (_odometry_last.timestamp != 0) {
+		if (instance_change || (odometry.reset_counter != _odometry_last.reset_counter)) {
+			++_odometry_reset_counter;
+		}
+
+	} else {
+		_odometry_reset_counter = odometry.reset_counter;
+	}
+
+	// ensure monotonically increasing timestamp_sample through a primary change
+	const bool publish = (odometry.timestamp_sample > _odometry_last.timestamp_sample);
+
+	// save last estimator_odometry as published with original resets
+	_odometry_last = odometry;
+
+	if (publish) {
+		odometry.reset_counter = _odometry_reset_counter;
+
+		_vehicle_odometry_pub.publish(odometry);
+	}
+}
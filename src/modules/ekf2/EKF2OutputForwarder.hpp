@@ -0,0 +1,135 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file EKF2OutputForwarder.hpp
+ * Publication of the vehicle outputs by the primary multi-instance EKF2 instance.
+ */
+
+#ifndef EKF2OUTPUTFORWARDER_HPP
+#define EKF2OUTPUTFORWARDER_HPP
+
+#include <lib/matrix/matrix/math.hpp>
+#include <uORB/Publication.hpp>
+#include <uORB/Subscription.hpp>
+#include <uORB/topics/estimator_selector_status.h>
+#include <uORB/topics/vehicle_attitude.h>
+#include <uORB/topics/vehicle_global_position.h>
+#include <uORB/topics/vehicle_local_position.h>
+#include <uORB/topics/vehicle_odometry.h>
+
+/**
+ * With multi-instance EKF2 the instance selected as primary by the EKF2Selector (estimator_selector_status)
+ * publishes its outputs directly as vehicle_attitude, vehicle_local_position, vehicle_global_position and
+ * vehicle_odometry from its own work item, instead of the selector copying every instance's outputs.
+ *
+ * The reset counters and deltas stay continuous across primary changes: the new primary continues from
+ * the last vehicle topics published by the previous one (the change counts as a reset), and afterwards
+ * adds its own estimator resets.
+ */
+class EKF2OutputForwarder
+{
+public:
+	EKF2OutputForwarder() = default;
+	~EKF2OutputForwarder() = default;
+
+	void set_instance(uint8_t instance) { _instance = instance; }
+
+	bool primary() const { return _primary; }
+
+	// estimator outputs of this instance, published as vehicle topics if this instance is the primary
+	void publish(const vehicle_attitude_s &estimator_attitude);
+	void publish(const vehicle_local_position_s &estimator_local_position);
+	void publish(const vehicle_global_position_s &estimator_global_position);
+	void publish(const vehicle_odometry_s &estimator_odometry);
+
+private:
+	static constexpr uint8_t INVALID_INSTANCE{UINT8_MAX};
+
+	// check for a primary instance change, just before publishing
+	bool updatePrimary();
+
+	uORB::Subscription _estimator_selector_status_sub{ORB_ID(estimator_selector_status)};
+
+	uint8_t _instance{INVALID_INSTANCE};
+	bool _primary{false};
+
+	// vehicle_attitude: reset counters
+	uORB::Subscription _vehicle_attitude_sub{ORB_ID(vehicle_attitude)};
+	uORB::Publication<vehicle_attitude_s> _vehicle_attitude_pub{ORB_ID(vehicle_attitude)};
+	vehicle_attitude_s _attitude_last{};
+	matrix::Quatf _delta_q_reset{};
+	uint8_t _quat_reset_counter{0};
+	bool _attitude_takeover{false};
+
+	// vehicle_local_position: reset counters
+	uORB::Subscription _vehicle_local_position_sub{ORB_ID(vehicle_local_position)};
+	uORB::Publication<vehicle_local_position_s> _vehicle_local_position_pub{ORB_ID(vehicle_local_position)};
+	vehicle_local_position_s _local_position_last{};
+	matrix::Vector2f _delta_xy_reset{};
+	float _delta_z_reset{0.f};
+	matrix::Vector2f _delta_vxy_reset{};
+	float _delta_vz_reset{0.f};
+	float _delta_heading_reset{0};
+	float _delta_hagl_reset{0.f};
+
+	uint8_t _xy_reset_counter{0};
+	uint8_t _z_reset_counter{0};
+	uint8_t _vxy_reset_counter{0};
+	uint8_t _vz_reset_counter{0};
+	uint8_t _heading_reset_counter{0};
+	uint8_t _hagl_reset_counter{0};
+	bool _local_position_takeover{false};
+
+	// vehicle_global_position: reset counters
+	uORB::Subscription _vehicle_global_position_sub{ORB_ID(vehicle_global_position)};
+	uORB::Publication<vehicle_global_position_s> _vehicle_global_position_pub{ORB_ID(vehicle_global_position)};
+	vehicle_global_position_s _global_position_last{};
+	float _delta_alt_reset{0.f};
+	float _delta_terrain_reset{0.f};
+
+	uint8_t _lat_lon_reset_counter{0};
+	uint8_t _alt_reset_counter{0};
+	uint8_t _terrain_reset_counter{0};
+	bool _global_position_takeover{false};
+
+	// vehicle_odometry
+	uORB::Subscription _vehicle_odometry_sub{ORB_ID(vehicle_odometry)};
+	uORB::Publication<vehicle_odometry_s> _vehicle_odometry_pub{ORB_ID(vehicle_odometry)};
+	vehicle_odometry_s _odometry_last{};
+	uint8_t _odometry_reset_counter{0};
+	bool _odometry_takeover{false};
+};
+
+#endif // !EKF2OUTPUTFORWARDER_HPP
@@ -34,8 +34,6 @@
 #include "EKF2Selector.hpp"
 
 using namespace time_literals;
-using matrix::Quatf;
-using matrix::Vector2f;
 using math::constrain;
 using math::radians;
 
@@ -45,10 +43,6 @@ EKF2Selector::EKF2Selector() :
 {
 	_estimator_selector_status_pub.advertise();
 	_sensor_selection_pub.advertise();
-	_vehicle_attitude_pub.advertise();
-	_vehicle_global_position_pub.advertise();
-	_vehicle_local_position_pub.advertise();
-	_vehicle_odometry_pub.advertise();
 	_wind_pub.advertise();
 }
 
@@ -60,8 +54,7 @@ EKF2Selector::~EKF2Selector()
 void EKF2Selector::Stop()
 {
 	for (int i = 0; i < EKF2_MAX_INSTANCES; i++) {
-		_instance[i].estimator_attitude_sub.unregisterCallback();
-		_instance[i].estimator_status_sub.unregisterCallback();
+		_instance[i].estimator_health_sub.unregisterCallback();
 	}
 
 	ScheduleClear();
@@ -119,20 +112,21 @@ bool EKF2Selector::SelectInstance(uint8_t ekf_instance)
 
 		if (_selected_instance != INVALID_INSTANCE) {
 			// switch callback registration
-			_instance[_selected_instance].estimator_attitude_sub.unregisterCallback();
-			_instance[_selected_instance].estimator_status_sub.unregisterCallback();
+			_instance[_selected_instance].estimator_health_sub.unregisterCallback();
 
 			PrintInstanceChange(_selected_instance, ekf_instance);
 		}
 
-		_instance[ekf_instance].estimator_attitude_sub.registerCallback();
-		_instance[ekf_instance].estimator_status_sub.registerCallback();
+		_instance[ekf_instance].estimator_health_sub.registerCallback();
 
 		_selected_instance = ekf_instance;
 		_instance_changed_count++;
 		_last_instance_change = sensor_selection.timestamp;
 		_instance[ekf_instance].time_last_selected = _last_instance_change;
 
+		// the instances pick up the new primary from the selector status
+		_selector_status_publish = true;
+
 		// reset all relative test ratios
 		for (uint8_t i = 0; i < _available_instances; i++) {
 			_instance[i].relative_test_ratio = 0;
@@ -258,9 +252,9 @@ bool EKF2Selector::UpdateErrorScores()
 	for (uint8_t i = 0; i < EKF2_MAX_INSTANCES; i++) {
 		const bool prev_healthy = _instance[i].healthy.get_state();
 
-		estimator_status_s status;
+		estimator_health_s status;
 
-		if (_instance[i].estimator_status_sub.update(&status)) {
+		if (_instance[i].estimator_health_sub.update(&status)) {
 
 			_instance[i].timestamp_last = status.timestamp;
 
@@ -361,314 +355,6 @@ bool EKF2Selector::UpdateErrorScores()
 	return (primary_updated || updated);
 }
 
-void EKF2Selector::PublishVehicleAttitude()
-{
-	// selected estimator_attitude -> vehicle_attitude
-	vehicle_attitude_s attitude;
-
-	if (_instance[_selected_instance].estimator_attitude_sub.update(&attitude)) {
-		bool instance_change = false;
-
-		if (_instance[_selected_instance].estimator_attitude_sub.get_instance() != _attitude_instance_prev) {
-			_attitude_instance_prev = _instance[_selected_instance].estimator_attitude_sub.get_instance();
-			instance_change = true;
-		}
-
-		if (_attitude_last.timestamp != 0) {
-			if (!instance_change && (attitude.quat_reset_counter == _attitude_last.quat_reset_counter + 1)) {
-				// propogate deltas from estimator data while maintaining the overall reset counts
-				++_quat_reset_counter;
-				_delta_q_reset = Quatf{attitude.delta_q_reset};
-
-			} else if (instance_change || (attitude.quat_reset_counter != _attitude_last.quat_reset_counter)) {
-				// on reset compute deltas from last published data
-				++_quat_reset_counter;
-				_delta_q_reset = (Quatf(attitude.q) * Quatf(_attitude_last.q).inversed()).normalized();
-			}
-
-		} else {
-			_quat_reset_counter = attitude.quat_reset_counter;
-			_delta_q_reset = Quatf{attitude.delta_q_reset};
-		}
-
-		bool publish = true;
-
-		// ensure monotonically increasing timestamp_sample through reset, don't publish
-		//  estimator's attitude for system (vehicle_attitude) if it's stale
-		if ((attitude.timestamp_sample <= _attitude_last.timestamp_sample)
-		    || (hrt_elapsed_time(&attitude.timestamp) > 10_ms)) {
-
-			publish = false;
-		}
-
-		// save last primary estimator_attitude as published with original resets
-		_attitude_last = attitude;
-
-		if (publish) {
-			// republish with total reset count and current timestamp
-			attitude.quat_reset_counter = _quat_reset_counter;
-			_delta_q_reset.copyTo(attitude.delta_q_reset);
-
-			attitude.timestamp = hrt_absolute_time();
-			_vehicle_attitude_pub.publish(attitude);
-		}
-	}
-}
-
-void EKF2Selector::PublishVehicleLocalPosition()
-{
-	// selected estimator_local_position -> vehicle_local_position
-	vehicle_local_position_s local_position;
-
-	if (_instance[_selected_instance].estimator_local_position_sub.update(&local_position)) {
-		bool instance_change = false;
-
-		if (_instance[_selected_instance].estimator_local_position_sub.get_instance() != _local_position_instance_prev) {
-			_local_position_instance_prev = _instance[_selected_instance].estimator_local_position_sub.get_instance();
-			instance_change = true;
-		}
-
-		if (_local_position_last.timestamp != 0) {
-			// XY reset
-			if (!instance_change && (local_position.xy_reset_counter == _local_position_last.xy_reset_counter + 1)) {
-				++_xy_reset_counter;
-				_delta_xy_reset = Vector2f{local_position.delta_xy};
-
-			} else if (instance_change || (local_position.xy_reset_counter != _local_position_last.xy_reset_counter)) {
-				++_xy_reset_counter;
-				_delta_xy_reset = Vector2f{local_position.x, local_position.y} - Vector2f{_local_position_last.x, _local_position_last.y};
-			}
-
-			// Z reset
-			if (!instance_change && (local_position.z_reset_counter == _local_position_last.z_reset_counter + 1)) {
-				++_z_reset_counter;
-				_delta_z_reset = local_position.delta_z;
-
-			} else if (instance_change || (local_position.z_reset_counter != _local_position_last.z_reset_counter)) {
-				++_z_reset_counter;
-				_delta_z_reset = local_position.z - _local_position_last.z;
-			}
-
-			// VXY reset
-			if (!instance_change && (local_position.vxy_reset_counter == _local_position_last.vxy_reset_counter + 1)) {
-				++_vxy_reset_counter;
-				_delta_vxy_reset = Vector2f{local_position.delta_vxy};
-
-			} else if (instance_change || (local_position.vxy_reset_counter != _local_position_last.vxy_reset_counter)) {
-				++_vxy_reset_counter;
-				_delta_vxy_reset = Vector2f{local_position.vx, local_position.vy} - Vector2f{_local_position_last.vx, _local_position_last.vy};
-			}
-
-			// VZ reset
-			if (!instance_change && (local_position.vz_reset_counter == _local_position_last.vz_reset_counter + 1)) {
-				++_vz_reset_counter;
-				_delta_vz_reset = local_position.delta_vz;
-
-			} else if (instance_change || (local_position.vz_reset_counter != _local_position_last.vz_reset_counter)) {
-				++_vz_reset_counter;
-				_delta_vz_reset = local_position.vz - _local_position_last.vz;
-			}
-
-			// heading reset
-			if (!instance_change && (local_position.heading_reset_counter == _local_position_last.heading_reset_counter + 1)) {
-				++_heading_reset_counter;
-				_delta_heading_reset = local_position.delta_heading;
-
-			} else if (instance_change || (local_position.heading_reset_counter != _local_position_last.heading_reset_counter)) {
-				++_heading_reset_counter;
-				_delta_heading_reset = matrix::wrap_pi(local_position.heading - _local_position_last.heading);
-			}
-
-			// HAGL (dist_bottom) reset
-			if (!instance_change
-			    && (local_position.dist_bottom_reset_counter == _local_position_last.dist_bottom_reset_counter + 1)) {
-				++_hagl_reset_counter;
-				_delta_hagl_reset = local_position.delta_dist_bottom;
-
-			} else if (instance_change
-				   || (local_position.dist_bottom_reset_counter != _local_position_last.dist_bottom_reset_counter)) {
-				++_hagl_reset_counter;
-				_delta_hagl_reset = local_position.dist_bottom - _local_position_last.dist_bottom;
-			}
-
-		} else {
-			_xy_reset_counter = local_position.xy_reset_counter;
-			_z_reset_counter = local_position.z_reset_counter;
-			_vxy_reset_counter = local_position.vxy_reset_counter;
-			_vz_reset_counter = local_position.vz_reset_counter;
-			_heading_reset_counter = local_position.heading_reset_counter;
-			_hagl_reset_counter = local_position.dist_bottom_reset_counter;
-
-			_delta_xy_reset = Vector2f{local_position.delta_xy};
-			_delta_z_reset = local_position.delta_z;
-			_delta_vxy_reset = Vector2f{local_position.delta_vxy};
-			_delta_vz_reset = local_position.delta_vz;
-			_delta_heading_reset = local_position.delta_heading;
-			_delta_hagl_reset = local_position.delta_dist_bottom;
-		}
-
-		bool publish = true;
-
-		// ensure monotonically increasing timestamp_sample through reset, don't publish
-		//  estimator's local position for system (vehicle_local_position) if it's stale
-		if ((local_position.timestamp_sample <= _local_position_last.timestamp_sample)
-		    || (hrt_elapsed_time(&local_position.timestamp) > 20_ms)) {
-
-			publish = false;
-		}
-
-		// save last primary estimator_local_position as published with original resets
-		_local_position_last = local_position;
-
-		if (publish) {
-			// republish with total reset count and current timestamp
-			local_position.xy_reset_counter = _xy_reset_counter;
-			local_position.z_reset_counter = _z_reset_counter;
-			local_position.vxy_reset_counter = _vxy_reset_counter;
-			local_position.vz_reset_counter = _vz_reset_counter;
-			local_position.heading_reset_counter = _heading_reset_counter;
-			local_position.dist_bottom_reset_counter = _hagl_reset_counter;
-
-			_delta_xy_reset.copyTo(local_position.delta_xy);
-			local_position.delta_z = _delta_z_reset;
-			_delta_vxy_reset.copyTo(local_position.delta_vxy);
-			local_position.delta_vz = _delta_vz_reset;
-			local_position.delta_heading = _delta_heading_reset;
-
-			local_position.timestamp = hrt_absolute_time();
-			_vehicle_local_position_pub.publish(local_position);
-		}
-	}
-}
-
-void EKF2Selector::PublishVehicleOdometry()
-{
-	// selected estimator_odometry -> vehicle_odometry
-	vehicle_odometry_s odometry;
-
-	if (_instance[_selected_instance].estimator_odometry_sub.update(&odometry)) {
-
-		bool instance_change = false;
-
-		if (_instance[_selected_instance].estimator_odometry_sub.get_instance() != _odometry_instance_prev) {
-			_odometry_instance_prev = _instance[_selected_instance].estimator_odometry_sub.get_instance();
-			instance_change = true;
-		}
-
-		if (_odometry_last.timestamp != 0) {
-			// reset
-			if (instance_change || (odometry.reset_counter != _odometry_last.reset_counter)) {
-				++_odometry_reset_counter;
-			}
-
-		} else {
-			_odometry_reset_counter = odometry.reset_counter;
-		}
-
-		bool publish = true;
-
-		// ensure monotonically increasing timestamp_sample through reset, don't publish
-		//  estimator's odometry for system (vehicle_odometry) if it's stale
-		if ((odometry.timestamp_sample <= _odometry_last.timestamp_sample)
-		    || (hrt_elapsed_time(&odometry.timestamp) > 20_ms)) {
-
-			publish = false;
-		}
-
-		// save last primary estimator_odometry as published with original resets
-		_odometry_last = odometry;
-
-		if (publish) {
-			// republish with total reset count and current timestamp
-			odometry.reset_counter = _odometry_reset_counter;
-
-			odometry.timestamp = hrt_absolute_time();
-			_vehicle_odometry_pub.publish(odometry);
-		}
-	}
-}
-
-void EKF2Selector::PublishVehicleGlobalPosition()
-{
-	// selected estimator_global_position -> vehicle_global_position
-	vehicle_global_position_s global_position;
-
-	if (_instance[_selected_instance].estimator_global_position_sub.update(&global_position)) {
-		bool instance_change = false;
-
-		if (_instance[_selected_instance].estimator_global_position_sub.get_instance() != _global_position_instance_prev) {
-			_global_position_instance_prev = _instance[_selected_instance].estimator_global_position_sub.get_instance();
-			instance_change = true;
-		}
-
-		if (_global_position_last.timestamp != 0) {
-			// lat/lon reset
-			if (!instance_change && (global_position.lat_lon_reset_counter == _global_position_last.lat_lon_reset_counter + 1)) {
-				++_lat_lon_reset_counter;
-
-				// TODO: delta latitude/longitude
-				_delta_lat_reset = global_position.lat - _global_position_last.lat;
-				_delta_lon_reset = global_position.lon - _global_position_last.lon;
-
-			} else if (instance_change || (global_position.lat_lon_reset_counter != _global_position_last.lat_lon_reset_counter)) {
-				++_lat_lon_reset_counter;
-
-				_delta_lat_reset = global_position.lat - _global_position_last.lat;
-				_delta_lon_reset = global_position.lon - _global_position_last.lon;
-			}
-
-			// alt reset
-			if (!instance_change && (global_position.alt_reset_counter == _global_position_last.alt_reset_counter + 1)) {
-				++_alt_reset_counter;
-				_delta_alt_reset = global_position.delta_alt;
-
-			} else if (instance_change || (global_position.alt_reset_counter != _global_position_last.alt_reset_counter)) {
-				++_alt_reset_counter;
-				_delta_alt_reset = global_position.delta_alt - _global_position_last.delta_alt;
-			}
-
-			// terrain reset
-			if (!instance_change && (global_position.terrain_reset_counter == _global_position_last.terrain_reset_counter + 1)) {
-				++_terrain_reset_counter;
-				_delta_terrain_reset = global_position.delta_terrain;
-
-			} else if (instance_change || (global_position.terrain_reset_counter != _global_position_last.terrain_reset_counter)) {
-				++_terrain_reset_counter;
-				_delta_terrain_reset = global_position.delta_terrain - _global_position_last.delta_terrain;
-			}
-
-		} else {
-			_lat_lon_reset_counter = global_position.lat_lon_reset_counter;
-			_alt_reset_counter = global_position.alt_reset_counter;
-
-			_delta_alt_reset = global_position.delta_alt;
-		}
-
-		bool publish = true;
-
-		// ensure monotonically increasing timestamp_sample through reset, don't publish
-		//  estimator's global position for system (vehicle_global_position) if it's stale
-		if ((global_position.timestamp_sample <= _global_position_last.timestamp_sample)
-		    || (hrt_elapsed_time(&global_position.timestamp) > 20_ms)) {
-
-			publish = false;
-		}
-
-		// save last primary estimator_global_position as published with original resets
-		_global_position_last = global_position;
-
-		if (publish) {
-			// republish with total reset count and current timestamp
-			global_position.lat_lon_reset_counter = _lat_lon_reset_counter;
-			global_position.alt_reset_counter = _alt_reset_counter;
-			global_position.delta_alt = _delta_alt_reset;
-
-			global_position.timestamp = hrt_absolute_time();
-			_vehicle_global_position_pub.publish(global_position);
-		}
-	}
-}
-
 void EKF2Selector::PublishWindEstimate()
 {
 	// selected estimator_wind -> wind
@@ -821,11 +507,7 @@ void EKF2Selector::Run()
 		}
 	}
 
-	// republish selected estimator data for system
-	PublishVehicleAttitude();
-	PublishVehicleLocalPosition();
-	PublishVehicleGlobalPosition();
-	PublishVehicleOdometry();
+	// republish selected estimator wind for system
 	PublishWindEstimate();
 
 	// re-schedule as backup timeout
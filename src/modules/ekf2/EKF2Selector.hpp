@@ -45,15 +45,11 @@
 #include <uORB/Subscription.hpp>
 #include <uORB/SubscriptionCallback.hpp>
 #include <uORB/Publication.hpp>
+#include <uORB/topics/estimator_health.h>
 #include <uORB/topics/estimator_selector_status.h>
-#include <uORB/topics/estimator_status.h>
 #include <uORB/topics/parameter_update.h>
 #include <uORB/topics/sensor_selection.h>
 #include <uORB/topics/sensors_status_imu.h>
-#include <uORB/topics/vehicle_attitude.h>
-#include <uORB/topics/vehicle_local_position.h>
-#include <uORB/topics/vehicle_global_position.h>
-#include <uORB/topics/vehicle_odometry.h>
 #include <uORB/topics/wind.h>
 
 #if CONSTRAINED_MEMORY
@@ -85,10 +81,6 @@ private:
 	void PrintInstanceChange(const uint8_t old_instance, uint8_t new_instance);
 
 	void PublishEstimatorSelectorStatus();
-	void PublishVehicleAttitude();
-	void PublishVehicleLocalPosition();
-	void PublishVehicleGlobalPosition();
-	void PublishVehicleOdometry();
 	void PublishWindEstimate();
 
 	bool SelectInstance(uint8_t instance);
@@ -97,26 +89,20 @@ private:
 	bool UpdateErrorScores();
 
 	// Subscriptions (per estimator instance)
+	// The primary instance publishes vehicle_attitude, vehicle_local_position, vehicle_global_position and
+	// vehicle_odometry itself (see EKF2OutputForwarder), the selector only scores the compact estimator_health.
 	struct EstimatorInstance {
 
 		EstimatorInstance(EKF2Selector *selector, uint8_t i) :
-			estimator_attitude_sub{selector, ORB_ID(estimator_attitude), i},
-			estimator_status_sub{selector, ORB_ID(estimator_status), i},
-			estimator_local_position_sub{ORB_ID(estimator_local_position), i},
-			estimator_global_position_sub{ORB_ID(estimator_global_position), i},
-			estimator_odometry_sub{ORB_ID(estimator_odometry), i},
+			estimator_health_sub{selector, ORB_ID(estimator_health), i},
 			estimator_wind_sub{ORB_ID(estimator_wind), i},
 			instance(i)
 		{
 			healthy.set_hysteresis_time_from(false, 1_s);
 		}
 
-		uORB::SubscriptionCallbackWorkItem estimator_attitude_sub;
-		uORB::SubscriptionCallbackWorkItem estimator_status_sub;
+		uORB::SubscriptionCallbackWorkItem estimator_health_sub;
 
-		uORB::Subscription estimator_local_position_sub;
-		uORB::Subscription estimator_global_position_sub;
-		uORB::Subscription estimator_odometry_sub;
 		uORB::Subscription estimator_wind_sub;
 
 		uint64_t timestamp_last{0};
@@ -190,60 +176,15 @@ private:
 	hrt_abstime _last_status_publish{0};
 	bool _selector_status_publish{false};
 
-	// vehicle_attitude: reset counters
-	vehicle_attitude_s _attitude_last{};
-	matrix::Quatf _delta_q_reset{};
-	uint8_t _quat_reset_counter{0};
-
-	// vehicle_local_position: reset counters
-	vehicle_local_position_s _local_position_last{};
-	matrix::Vector2f _delta_xy_reset{};
-	float _delta_z_reset{0.f};
-	matrix::Vector2f _delta_vxy_reset{};
-	float _delta_vz_reset{0.f};
-	float _delta_heading_reset{0};
-	float _delta_hagl_reset{0.f};
-
-	uint8_t _xy_reset_counter{0};
-	uint8_t _z_reset_counter{0};
-	uint8_t _vxy_reset_counter{0};
-	uint8_t _vz_reset_counter{0};
-	uint8_t _heading_reset_counter{0};
-	uint8_t _hagl_reset_counter{0};
-
-	// vehicle_odometry
-	vehicle_odometry_s _odometry_last{};
-	uint8_t _odometry_reset_counter{0};
-
-	// vehicle_global_position: reset counters
-	vehicle_global_position_s _global_position_last{};
-	double _delta_lat_reset{0};
-	double _delta_lon_reset{0};
-	float _delta_alt_reset{0.f};
-	float _delta_terrain_reset{0.f};
-
-	uint8_t _lat_lon_reset_counter{0};
-	uint8_t _alt_reset_counter{0};
-	uint8_t _terrain_reset_counter{0};
-
 	// wind estimate
 	wind_s _wind_last{};
 
-	uint8_t _attitude_instance_prev{INVALID_INSTANCE};
-	uint8_t _local_position_instance_prev{INVALID_INSTANCE};
-	uint8_t _global_position_instance_prev{INVALID_INSTANCE};
-	uint8_t _odometry_instance_prev{INVALID_INSTANCE};
-
 	uORB::SubscriptionInterval _parameter_update_sub{ORB_ID(parameter_update), 1_s};
 	uORB::Subscription _sensors_status_imu{ORB_ID(sensors_status_imu)};
 
 	// Publications
 	uORB::Publication<estimator_selector_status_s> _estimator_selector_status_pub{ORB_ID(estimator_selector_status)};
 	uORB::Publication<sensor_selection_s>          _sensor_selection_pub{ORB_ID(sensor_selection)};
-	uORB::Publication<vehicle_attitude_s>          _vehicle_attitude_pub{ORB_ID(vehicle_attitude)};
-	uORB::Publication<vehicle_global_position_s>   _vehicle_global_position_pub{ORB_ID(vehicle_global_position)};
-	uORB::Publication<vehicle_local_position_s>    _vehicle_local_position_pub{ORB_ID(vehicle_local_position)};
-	uORB::Publication<vehicle_odometry_s>          _vehicle_odometry_pub{ORB_ID(vehicle_odometry)};
 	uORB::Publication<wind_s>             _wind_pub{ORB_ID(wind)};
 
 	DEFINE_PARAMETERS(
@@ -0,0 +1,275 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include "batch_replay.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <type_traits>
+
+#include "sensor_simulator/sensor_simulator.h"
+
+// generated from the parameter bindings of the EKF2 module, see generate_parameter_table.py
+#define PARAM(name, field) {#name, [](parameters &p, float value) { p.field = static_cast<std::remove_reference_t<decltype(p.field)>>(value); }},
+
+static constexpr struct {
+	const char *name;
+	void (*set)(parameters &, float);
+} parameter_table[] = {
+#include "ekf2_parameter_table.h"
+};
+
+#undef PARAM
+
+BatchReplay::BatchReplay(std::shared_ptr<const ReplayData> replay_data) :
+	_replay_data(replay_data)
+{
+}
+
+bool BatchReplay::setParameter(parameters &params, const char *name, float value)
+{
+	for (const auto &param : parameter_table) {
+		if (strcmp(name, param.name) == 0) {
+			param.set(params, value);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool BatchReplay::loadParameterSets(const std::string &file_name)
+{
+	std::ifstream file(file_name);
+
+	if (!file.is_open()) {
+		std::cout << "Could not open parameter set file " << file_name << std::endl;
+		return false;
+	}
+
+	std::string line;
+
+	while (std::getline(file, line)) {
+		if (line.empty() || line[0] == '#') {
+			continue;
+		}
+
+		std::stringstream ss(line);
+		std::string field;
+		ParameterSet parameter_set;
+
+		std::getline(ss, parameter_set.name, ',');
+
+		while (std::getline(ss, field, ',')) {
+			const size_t separator = field.find('=');
+
+			if (separator == std::string::npos) {
+				std::cout << "Malformed parameter '" << field << "' in set " << parameter_set.name << std::endl;
+				return false;
+			}
+
+			parameter_set.values.emplace_back(field.substr(0, separator), strtof(field.c_str() + separator + 1, nullptr));
+		}
+
+		_parameter_sets.push_back(parameter_set);
+	}
+
+	return true;
+}
+
+static void updateInnovationStatistics(const Ekf &ekf, std::vector<InnovationStatistics> &statistics)
+{
+	size_t index = 0;
+
+	auto update = [&](const char *aid_source, const auto & aid_src) {
+		if (index >= statistics.size()) {
+			statistics.emplace_back();
+			statistics.back().aid_source = aid_source;
+		}
+
+		statistics[index++].update(aid_src);
+	};
+
+#if defined(CONFIG_EKF2_BAROMETER)
+	update("baro_hgt", ekf.aid_src_baro_hgt());
+#endif // CONFIG_EKF2_BAROMETER
+#if defined(CONFIG_EKF2_RANGE_FINDER)
+	update("rng_hgt", ekf.aid_src_rng_hgt());
+#endif // CONFIG_EKF2_RANGE_FINDER
+#if defined(CONFIG_EKF2_OPTICAL_FLOW)
+	update("optical_flow", ekf.aid_src_optical_flow());
+#endif // CONFIG_EKF2_OPTICAL_FLOW
+#if defined(CONFIG_EKF2_DRAG_FUSION)
+	update("drag", ekf.aid_src_drag());
+#endif // CONFIG_EKF2_DRAG_FUSION
+#if defined(CONFIG_EKF2_GRAVITY_FUSION)
+	update("gravity", ekf.aid_src_gravity());
+#endif // CONFIG_EKF2_GRAVITY_FUSION
+#if defined(CONFIG_EKF2_AIRSPEED)
+	update("airspeed", ekf.aid_src_airspeed());
+#endif // CONFIG_EKF2_AIRSPEED
+#if defined(CONFIG_EKF2_SIDESLIP)
+	update("sideslip", ekf.aid_src_sideslip());
+#endif // CONFIG_EKF2_SIDESLIP
+#if defined(CONFIG_EKF2_EXTERNAL_VISION)
+	update("ev_hgt", ekf.aid_src_ev_hgt());
+	update("ev_pos", ekf.aid_src_ev_pos());
+	update("ev_vel", ekf.aid_src_ev_vel());
+	update("ev_yaw", ekf.aid_src_ev_yaw());
+#endif // CONFIG_EKF2_EXTERNAL_VISION
+#if defined(CONFIG_EKF2_GNSS)
+	update("gnss_hgt", ekf.aid_src_gnss_hgt());
+	update("gnss_pos", ekf.aid_src_gnss_pos());
+	update("gnss_vel", ekf.aid_src_gnss_vel());
+# if defined(CONFIG_EKF2_GNSS_YAW)
+	update("gnss_yaw", ekf.aid_src_gnss_yaw());
+# endif // CONFIG_EKF2_GNSS_YAW
+#endif // CONFIG_EKF2_GNSS
+#if defined(CONFIG_EKF2_MAGNETOMETER)
+	update("mag", ekf.aid_src_mag());
+#endif // CONFIG_EKF2_MAGNETOMETER
+#if defined(CONFIG_EKF2_AUXVEL)
+	update("aux_vel", ekf.aid_src_aux_vel());
+#endif // CONFIG_EKF2_AUXVEL
+}
+
+BatchReplayResult BatchReplay::replay(const ParameterSet &parameter_set, float duration_s) const
+{
+	BatchReplayResult result{};
+	result.name = parameter_set.name;
+
+	std::shared_ptr<Ekf> ekf = std::make_shared<Ekf>();
+
+	for (const auto &value : parameter_set.values) {
+		if (!setParameter(*ekf->getParamHandle(), value.first.c_str(), value.second)) {
+			std::cout << "Unknown parameter " << value.first << " in set " << parameter_set.name << std::endl;
+			return result;
+		}
+	}
+
+	// parameters affecting the buffer sizes need to be set before initialisation
+	ekf->init(0);
+
+	SensorSimulator sensor_simulator(ekf);
+	sensor_simulator.setReplayData(_replay_data);
+	sensor_simulator.startReplaySensors();
+
+	uint64_t end_time = _replay_data->endTime();
+
+	if (duration_s > 0.f) {
+		end_time = std::min(end_time, _replay_data->startTime() + static_cast<uint64_t>(duration_s * 1e6f));
+	}
+
+	while (!sensor_simulator.replayFinished() && (sensor_simulator.getTime() < end_time)) {
+		// single simulation step
+		sensor_simulator.runReplayMicroseconds(1000);
+		updateInnovationStatistics(*ekf, result.innovations);
+	}
+
+	result.valid = true;
+	result.tilt_aligned = ekf->control_status_flags().tilt_align;
+	result.duration_us = sensor_simulator.getTime();
+
+	return result;
+}
+
+void BatchReplay::run(unsigned num_threads, float duration_s)
+{
+	_results.clear();
+	_results.resize(_parameter_sets.size());
+
+	if (num_threads == 0) {
+		num_threads = std::max(std::thread::hardware_concurrency(), 1u);
+	}
+
+	num_threads = std::min(num_threads, static_cast<unsigned>(_parameter_sets.size()));
+
+	// each worker picks the next parameter set until all are done
+	std::atomic<size_t> next_set{0};
+
+	auto worker = [&]() {
+		for (size_t i = next_set++; i < _parameter_sets.size(); i = next_set++) {
+			_results[i] = replay(_parameter_sets[i], duration_s);
+		}
+	};
+
+	std::vector<std::thread> threads;
+
+	for (unsigned i = 0; i < num_threads; i++) {
+		threads.emplace_back(worker);
+	}
+
+	for (auto &thread : threads) {
+		thread.join();
+	}
+}
+
+bool BatchReplay::writeSummaries(const std::string &directory) const
+{
+	for (const auto &result : _results) {
+		if (!result.valid) {
+			continue;
+		}
+
+		const std::string file_name = directory + "/" + result.name + "_innovations.csv";
+		std::ofstream file(file_name);
+
+		if (!file.is_open()) {
+			std::cout << "Could not write " << file_name << std::endl;
+			return false;
+		}
+
+		file << "aid_source,samples,fused,rejected,innovation_rms,test_ratio_mean,test_ratio_max" << std::endl;
+
+		for (const auto &stats : result.innovations) {
+			if (stats.samples == 0) {
+				continue;
+			}
+
+			file << stats.aid_source << ","
+			     << stats.samples << ","
+			     << stats.fused << ","
+			     << stats.rejected << ","
+			     << stats.innovationRms() << ","
+			     << stats.testRatioMean() << ","
+			     << stats.test_ratio_max << std::endl;
+		}
+	}
+
+	return true;
+}
@@ -0,0 +1,170 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * Batch replay of sensor data through multiple independent EKF instances.
+ * The replay data is loaded once and shared read-only between the filter instances,
+ * each parameter set is replayed on a pool of worker threads, outside of the
+ * uORB/work queue runtime.
+ */
+#ifndef EKF_BATCH_REPLAY_H
+#define EKF_BATCH_REPLAY_H
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "EKF/ekf.h"
+#include "sensor_simulator/replay_data.h"
+
+struct ParameterSet {
+	std::string name;
+	std::vector<std::pair<std::string, float>> values; ///< EKF2 parameter name (e.g. EKF2_GPS_P_GATE) and value
+};
+
+/**
+ * Innovation statistics of a single aid source over a full replay
+ */
+struct InnovationStatistics {
+	const char *aid_source{nullptr};
+
+	uint32_t samples{0};  ///< number of observations processed
+	uint32_t fused{0};    ///< number of observations fused
+	uint32_t rejected{0}; ///< number of observations rejected by the innovation gate
+
+	double innovation_sq_sum{0.0};      ///< sum of squared innovations over all axes
+	double test_ratio_sum{0.0};         ///< sum of the normalized innovation squared over all axes
+	double test_ratio_max{0.0};
+	uint32_t axis_samples{0};           ///< number of (sample, axis) pairs accumulated in the sums
+
+	uint64_t last_timestamp_sample{0};
+
+	double innovationRms() const { return axis_samples > 0 ? sqrt(innovation_sq_sum / axis_samples) : 0.0; }
+	double testRatioMean() const { return axis_samples > 0 ? test_ratio_sum / axis_samples : 0.0; }
+
+	void accumulate(float innovation, float test_ratio)
+	{
+		if (PX4_ISFINITE(innovation) && PX4_ISFINITE(test_ratio)) {
+			innovation_sq_sum += (double)innovation * (double)innovation;
+			test_ratio_sum += test_ratio;
+			test_ratio_max = fmax(test_ratio_max, (double)test_ratio);
+			axis_samples++;
+		}
+	}
+
+	template <size_t N>
+	void accumulate(const float(&innovation)[N], const float(&test_ratio)[N])
+	{
+		for (size_t i = 0; i < N; i++) {
+			accumulate(innovation[i], test_ratio[i]);
+		}
+	}
+
+	template <typename T>
+	void update(const T &aid_src)
+	{
+		if (aid_src.timestamp_sample == 0 || aid_src.timestamp_sample == last_timestamp_sample) {
+			return;
+		}
+
+		last_timestamp_sample = aid_src.timestamp_sample;
+		samples++;
+
+		if (aid_src.fused) {
+			fused++;
+		}
+
+		if (aid_src.innovation_rejected) {
+			rejected++;
+		}
+
+		accumulate(aid_src.innovation, aid_src.test_ratio);
+	}
+};
+
+struct BatchReplayResult {
+	std::string name;
+	bool valid{false};                             ///< false if the parameter set could not be applied
+	bool tilt_aligned{false};
+	uint64_t duration_us{0};                       ///< replayed time
+	std::vector<InnovationStatistics> innovations{};
+};
+
+class BatchReplay
+{
+public:
+	explicit BatchReplay(std::shared_ptr<const ReplayData> replay_data);
+	~BatchReplay() = default;
+
+	void addParameterSet(const ParameterSet &parameter_set) { _parameter_sets.push_back(parameter_set); }
+
+	/**
+	 * Parse a parameter set file, with one parameter set per line: "name,EKF2_PARAM=value,EKF2_PARAM=value,...".
+	 * Empty lines and lines starting with '#' are ignored.
+	 * @return false if the file could not be read or is malformed
+	 */
+	bool loadParameterSets(const std::string &file_name);
+
+	size_t numParameterSets() const { return _parameter_sets.size(); }
+
+	/**
+	 * Replay all parameter sets.
+	 * @param num_threads number of worker threads, 0 uses all hardware threads
+	 * @param duration_s maximum replay duration, 0 replays the full data
+	 */
+	void run(unsigned num_threads = 0, float duration_s = 0.f);
+
+	const std::vector<BatchReplayResult> &results() const { return _results; }
+
+	/**
+	 * Write one innovation statistics summary file per parameter set into the given directory
+	 * @return false if a file could not be written
+	 */
+	bool writeSummaries(const std::string &directory) const;
+
+	/**
+	 * Set an EKF2 parameter by name on the given parameter struct
+	 * @return false if the parameter is unknown
+	 */
+	static bool setParameter(parameters &params, const char *name, float value);
+
+private:
+	BatchReplayResult replay(const ParameterSet &parameter_set, float duration_s) const;
+
+	std::shared_ptr<const ReplayData> _replay_data;
+
+	std::vector<ParameterSet> _parameter_sets{};
+	std::vector<BatchReplayResult> _results{};
+};
+#endif // !EKF_BATCH_REPLAY_H
@@ -0,0 +1,147 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * Replay a sensor data file (see sensor_simulator/convertULogToSensorData.py) with several
+ * EKF parameter sets in parallel and write innovation statistics for each set.
+ *
+ * usage: ekf2_batch_replay [-j <threads>] [-t <duration s>] [-o <output dir>] <sensor data file> <parameter set file>
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <unistd.h>
+
+#include "batch_replay.h"
+
+static void usage(const char *name)
+{
+	printf("usage: %s [-j <threads>] [-t <duration s>] [-o <output dir>] <sensor data file> <parameter set file>\n", name);
+	printf("\n");
+	printf(" -j <threads>     number of worker threads (default: number of hardware threads)\n");
+	printf(" -t <duration s>  replay at most the given duration (default: full log)\n");
+	printf(" -o <output dir>  directory for the innovation summaries (default: .)\n");
+	printf("\n");
+	printf("The parameter set file contains one set per line: name,EKF2_PARAM=value,EKF2_PARAM=value,...\n");
+}
+
+int main(int argc, char *argv[])
+{
+	unsigned num_threads = 0;
+	float duration_s = 0.f;
+	std::string output_directory = ".";
+
+	int ch;
+
+	while ((ch = getopt(argc, argv, "j:t:o:h")) != -1) {
+		switch (ch) {
+		case 'j':
+			num_threads = strtoul(optarg, nullptr, 10);
+			break;
+
+		case 't':
+			duration_s = strtof(optarg, nullptr);
+			break;
+
+		case 'o':
+			output_directory = optarg;
+			break;
+
+		default:
+			usage(argv[0]);
+			return 1;
+		}
+	}
+
+	if (argc - optind != 2) {
+		usage(argv[0]);
+		return 1;
+	}
+
+	const auto load_start = std::chrono::steady_clock::now();
+
+	auto replay_data = std::make_shared<ReplayData>();
+
+	if (!replay_data->loadFromFile(argv[optind])) {
+		return 1;
+	}
+
+	BatchReplay batch_replay(replay_data);
+
+	if (!batch_replay.loadParameterSets(argv[optind + 1])) {
+		return 1;
+	}
+
+	const auto replay_start = std::chrono::steady_clock::now();
+
+	printf("loaded %zu samples (%.1f s) in %.2f s, replaying %zu parameter sets\n", replay_data->size(),
+	       (replay_data->endTime() - replay_data->startTime()) * 1e-6,
+	       std::chrono::duration<double>(replay_start - load_start).count(),
+	       batch_replay.numParameterSets());
+
+	batch_replay.run(num_threads, duration_s);
+
+	const double replay_time_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - replay_start).count();
+
+	int num_failed = 0;
+
+	for (const auto &result : batch_replay.results()) {
+		if (!result.valid) {
+			printf("%s: failed\n", result.name.c_str());
+			num_failed++;
+			continue;
+		}
+
+		printf("%s: %.1f s replayed%s\n", result.name.c_str(), result.duration_us * 1e-6,
+		       result.tilt_aligned ? "" : " (tilt not aligned)");
+
+		for (const auto &stats : result.innovations) {
+			if (stats.samples > 0) {
+				printf("  %-14s samples: %6u fused: %6u rejected: %6u innov rms: %8.4f test ratio mean: %6.3f max: %8.3f\n",
+				       stats.aid_source, stats.samples, stats.fused, stats.rejected,
+				       stats.innovationRms(), stats.testRatioMean(), stats.test_ratio_max);
+			}
+		}
+	}
+
+	printf("replayed %zu parameter sets in %.2f s\n", batch_replay.numParameterSets(), replay_time_s);
+
+	if (!batch_replay.writeSummaries(output_directory)) {
+		return 1;
+	}
+
+	return num_failed > 0 ? 1 : 0;
+}
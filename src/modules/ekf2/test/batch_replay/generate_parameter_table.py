@@ -0,0 +1,95 @@
+#!/usr/bin/env python3
+############################################################################
+#
+#   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+#
+# 1. Redistributions of source code must retain the above copyright
+#    notice, this list of conditions and the following disclaimer.
+# 2. Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in
+#    the documentation and/or other materials provided with the
+#    distribution.
+# 3. Neither the name PX4 nor the names of its contributors may be
+#    used to endorse or promote products derived from this software
+#    without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+# FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+# COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+# INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+# BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+# OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+# AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+# LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+# ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+#
+############################################################################
+"""
+Generate the EKF2 parameter table of the batch replay from the EKF2 module.
+
+The table maps every parameter bound to the estimator parameters (the ParamExt members declared
+in EKF2.hpp) to the field it is bound to in the EKF2 constructor (EKF2.cpp), keeping the
+preprocessor conditions of the constructor. Generation fails if a bound parameter has no field.
+"""
+
+import argparse
+import re
+import sys
+
+parser = argparse.ArgumentParser(description='Generate the EKF2 batch replay parameter table')
+parser.add_argument('--hpp', required=True, help='EKF2.hpp')
+parser.add_argument('--cpp', required=True, help='EKF2.cpp')
+parser.add_argument('--output', required=True, help='output header')
+args = parser.parse_args()
+
+# (ParamExtFloat<px4::params::EKF2_GYR_NOISE>) _param_ekf2_gyr_noise,
+declaration = re.compile(r'\(ParamExt\w+<px4::params::(\w+)>\)\s*(\w+)')
+
+# _param_ekf2_gyr_noise(_params->gyro_noise),
+binding = re.compile(r'^\s*(_param_\w+)\(_params->(.+)\),?\s*$')
+
+with open(args.hpp) as f:
+    bound_parameters = {member: name for name, member in declaration.findall(f.read())}
+
+lines = []
+mapped = set()
+in_constructor = False
+
+with open(args.cpp) as f:
+    for line in f:
+        if line.startswith('EKF2::EKF2('):
+            in_constructor = True
+
+        elif in_constructor and line.startswith('{'):
+            break
+
+        elif in_constructor:
+            match = binding.match(line)
+
+            if match:
+                member, field = match.groups()
+
+                if member not in bound_parameters:
+                    sys.exit(f'error: {member} is bound in {args.cpp} but not declared as ParamExt in {args.hpp}')
+
+                lines.append(f'PARAM({bound_parameters[member]}, {field})\n')
+                mapped.add(member)
+
+            elif line.lstrip().startswith('#'):
+                lines.append(line.lstrip(' \t'))
+
+unmapped = sorted(bound_parameters[member] for member in bound_parameters.keys() - mapped)
+
+if unmapped:
+    sys.exit(f'error: parameters not bound in the EKF2 constructor: {", ".join(unmapped)}')
+
+with open(args.output, 'w') as f:
+    f.write(f'// generated by {sys.argv[0].split("/")[-1]} from EKF2.hpp and EKF2.cpp, do not edit\n\n')
+    f.writelines(lines)
@@ -0,0 +1,848 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * Deterministic EKF throughput benchmark.
+ *
+ * Drives the Ekf with the sensor simulator through a set of aiding profiles and reports the time
+ * per Ekf::update() call, the additional time of each fusion (or combination of fusions happening
+ * in the same update), and the heap and stack high-water marks of each profile.
+ * Estimator components that are not exercised separately by the profiles (e.g. the EKF-GSF yaw
+ * estimator bank or the fixed-lag smoother backward pass) are timed on their own.
+ * The results can be written in the Google Benchmark JSON format and compared against a baseline,
+ * e.g. in CI.
+ *
+ * usage: ekf2_benchmark [-t <duration s>] [-p <profile>] [-o <json file>] [-b <baseline json file>] [-r <max regression %>]
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <malloc.h>
+#include <map>
+#include <new>
+#include <pthread.h>
+#include <sstream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+#include "EKF/ekf.h"
+#include "EKF/yaw_estimator/EKFGSF_yaw.h"
+#include "sensor_simulator/sensor_simulator.h"
+#include "sensor_simulator/ekf_wrapper.h"
+
+// Heap accounting of all operator new allocations (usable size of the underlying malloc)
+static std::atomic<size_t> heap_current{0};
+static std::atomic<size_t> heap_peak{0};
+static std::atomic<uint64_t> heap_allocations{0};
+
+void *operator new (size_t size)
+{
+	void *p = malloc(size);
+
+	if (p == nullptr) {
+		throw std::bad_alloc();
+	}
+
+	const size_t current = (heap_current += malloc_usable_size(p));
+	size_t peak = heap_peak.load();
+
+	while (current > peak && !heap_peak.compare_exchange_weak(peak, current)) {}
+
+	heap_allocations++;
+
+	return p;
+}
+
+void *operator new[](size_t size) { return operator new (size); }
+
+// the memory of operator new above is from malloc
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+void operator delete (void *ptr) noexcept
+{
+	if (ptr != nullptr) {
+		heap_current -= malloc_usable_size(ptr);
+		free(ptr);
+	}
+}
+#pragma GCC diagnostic pop
+
+void operator delete[](void *ptr) noexcept { operator delete (ptr); }
+void operator delete (void *ptr, size_t) noexcept { operator delete (ptr); }
+void operator delete[](void *ptr, size_t) noexcept { operator delete (ptr); }
+
+namespace
+{
+
+using clock_type = std::chrono::steady_clock;
+
+struct AidSource {
+	const char *name;
+	uint64_t (*time_last_fuse)(const Ekf &ekf);
+};
+
+// aiding sources used to attribute the time of an update to the fusions it did
+const AidSource kAidSources[] {
+	{"baro_hgt",     [](const Ekf & ekf) { return ekf.aid_src_baro_hgt().time_last_fuse; }},
+	{"gnss_pos",     [](const Ekf & ekf) { return ekf.aid_src_gnss_pos().time_last_fuse; }},
+	{"gnss_vel",     [](const Ekf & ekf) { return ekf.aid_src_gnss_vel().time_last_fuse; }},
+	{"gnss_hgt",     [](const Ekf & ekf) { return ekf.aid_src_gnss_hgt().time_last_fuse; }},
+	{"mag",          [](const Ekf & ekf) { return ekf.aid_src_mag().time_last_fuse; }},
+	{"optical_flow", [](const Ekf & ekf) { return ekf.aid_src_optical_flow().time_last_fuse; }},
+	{"rng_hgt",      [](const Ekf & ekf) { return ekf.aid_src_rng_hgt().time_last_fuse; }},
+	{"ev_pos",       [](const Ekf & ekf) { return ekf.aid_src_ev_pos().time_last_fuse; }},
+	{"ev_vel",       [](const Ekf & ekf) { return ekf.aid_src_ev_vel().time_last_fuse; }},
+	{"ev_hgt",       [](const Ekf & ekf) { return ekf.aid_src_ev_hgt().time_last_fuse; }},
+	{"ev_yaw",       [](const Ekf & ekf) { return ekf.aid_src_ev_yaw().time_last_fuse; }},
+	{"fake_pos",     [](const Ekf & ekf) { return ekf.aid_src_fake_pos().time_last_fuse; }},
+	{"fake_hgt",     [](const Ekf & ekf) { return ekf.aid_src_fake_hgt().time_last_fuse; }},
+	{"gravity",      [](const Ekf & ekf) { return ekf.aid_src_gravity().time_last_fuse; }},
+};
+
+static constexpr size_t kNumAidSources = sizeof(kAidSources) / sizeof(kAidSources[0]);
+
+struct Profile {
+	const char *name;
+	const char *description;
+	void (*start)(std::shared_ptr<Ekf> &ekf, SensorSimulator &sensor_simulator, EkfWrapper &ekf_wrapper);
+};
+
+const Profile kProfiles[] {
+	{
+		"gps", "baro, mag and GNSS position and velocity",
+		[](std::shared_ptr<Ekf> &, SensorSimulator & sensor_simulator, EkfWrapper & ekf_wrapper)
+		{
+			ekf_wrapper.enableGpsFusion();
+			sensor_simulator.startGps();
+		}
+	},
+	{
+		"flow_range", "baro, mag, optical flow and range finder",
+		[](std::shared_ptr<Ekf> &ekf, SensorSimulator & sensor_simulator, EkfWrapper & ekf_wrapper)
+		{
+			ekf->set_optical_flow_limits(5.f, 0.f, 50.f);
+			sensor_simulator._rng.setData(1.5f, 100);
+			sensor_simulator._rng.setLimits(0.1f, 9.f);
+			ekf_wrapper.enableRangeHeightFusion();
+			ekf_wrapper.enableFlowFusion();
+			sensor_simulator.startRangeFinder();
+			sensor_simulator.startFlow();
+		}
+	},
+	{
+		"ev", "baro, mag and external vision position, velocity and height",
+		[](std::shared_ptr<Ekf> &, SensorSimulator & sensor_simulator, EkfWrapper & ekf_wrapper)
+		{
+			sensor_simulator._vio.setPositionFrameToLocalNED();
+			ekf_wrapper.enableExternalVisionPositionFusion();
+			ekf_wrapper.enableExternalVisionVelocityFusion();
+			ekf_wrapper.enableExternalVisionHeightFusion();
+			sensor_simulator.startExternalVision();
+		}
+	},
+	{
+		"uwb_as_gps", "baro, mag and a local positioning system (e.g. UWB) emulating a GNSS receiver",
+		[](std::shared_ptr<Ekf> &ekf, SensorSimulator & sensor_simulator, EkfWrapper &)
+		{
+			// high rate and accurate position, no usable velocity
+			gnssSample gnss = sensor_simulator._gps.getDefaultGpsData();
+			gnss.hacc = 0.1f;
+			gnss.vacc = 0.15f;
+			gnss.sacc = 0.3f;
+			sensor_simulator._gps.setData(gnss);
+			sensor_simulator._gps.setRateHz(10);
+
+			ekf->getParamHandle()->gnss_ctrl = static_cast<int32_t>(GnssCtrl::HPOS) | static_cast<int32_t>(GnssCtrl::VPOS);
+			sensor_simulator.startGps();
+		}
+	},
+	{
+		"multi_aid", "baro, mag, GNSS, optical flow, range finder and external vision",
+		[](std::shared_ptr<Ekf> &ekf, SensorSimulator & sensor_simulator, EkfWrapper & ekf_wrapper)
+		{
+			ekf->set_optical_flow_limits(5.f, 0.f, 50.f);
+			sensor_simulator._rng.setData(1.5f, 100);
+			sensor_simulator._rng.setLimits(0.1f, 9.f);
+			sensor_simulator._vio.setPositionFrameToLocalNED();
+
+			ekf_wrapper.enableGpsFusion();
+			ekf_wrapper.enableRangeHeightFusion();
+			ekf_wrapper.enableFlowFusion();
+			ekf_wrapper.enableExternalVisionPositionFusion();
+			ekf_wrapper.enableExternalVisionVelocityFusion();
+
+			sensor_simulator.startGps();
+			sensor_simulator.startRangeFinder();
+			sensor_simulator.startFlow();
+			sensor_simulator.startExternalVision();
+		}
+	},
+};
+
+struct Timing {
+	std::vector<float> samples_ns;
+	double sum_ns{0.};
+
+	void add(float ns) { samples_ns.push_back(ns); sum_ns += ns; }
+	uint64_t count() const { return samples_ns.size(); }
+	double mean() const { return samples_ns.empty() ? 0. : sum_ns / samples_ns.size(); }
+
+	double percentile(float p) const
+	{
+		if (samples_ns.empty()) {
+			return 0.;
+		}
+
+		std::vector<float> sorted = samples_ns;
+		const size_t index = std::min(sorted.size() - 1, (size_t)(p * sorted.size()));
+		std::nth_element(sorted.begin(), sorted.begin() + index, sorted.end());
+		return sorted[index];
+	}
+};
+
+struct Result {
+	std::string name;
+	uint64_t iterations{0};
+	double time_ns{0.};
+	std::vector<std::pair<std::string, double>> counters;
+};
+
+struct Component {
+	const char *name;
+	const char *description;
+	Result (*run)(float duration_s);
+};
+
+const Component kComponents[] {
+	{
+		"yaw_estimator", "EKF-GSF yaw estimator bank alone, level constant rate turn with velocity aiding",
+		[](float duration_s)
+		{
+			const float dt = 0.005f;           // IMU rate: 200 Hz
+			const int vel_decimation = 20;     // velocity aiding rate: 10 Hz
+			const float speed = 10.f;          // (m/s)
+			const float yaw_rate = 0.2f;       // (rad/s)
+
+			EKFGSF_yaw yaw_estimator;
+			yaw_estimator.setTrueAirspeed(speed);
+
+			const Vector3f delta_vel = Vector3f(0.f, speed * yaw_rate, -CONSTANTS_ONE_G) * dt;
+			const Vector3f delta_ang = Vector3f(0.f, 0.f, yaw_rate) * dt;
+
+			const uint64_t n_updates = std::max((uint64_t)(duration_s / dt), (uint64_t)1);
+			float yaw = 0.f;
+
+			const auto start = clock_type::now();
+
+			for (uint64_t i = 0; i < n_updates; i++) {
+				yaw = matrix::wrap_pi(yaw + yaw_rate * dt);
+				yaw_estimator.predict(delta_ang, dt, delta_vel, dt, true);
+
+				if ((i % vel_decimation) == 0) {
+					yaw_estimator.fuseVelocity(Vector2f(speed * cosf(yaw), speed * sinf(yaw)), 0.5f, true);
+				}
+			}
+
+			const auto end = clock_type::now();
+
+			Result result{"yaw_estimator/update", n_updates, std::chrono::duration<double, std::nano>(end - start).count() / n_updates};
+			result.counters = {{"models", (double)N_MODELS_EKFGSF}};
+			return result;
+		}
+	},
+	{
+		"smoother", "fixed-lag smoother backward pass (lag 20) after GNSS aided alignment",
+		[](float duration_s)
+		{
+			static constexpr int kLag = 20;
+
+			std::shared_ptr<Ekf> ekf = std::make_shared<Ekf>();
+			SensorSimulator sensor_simulator(ekf);
+			EkfWrapper ekf_wrapper(ekf);
+
+			ekf->getParamHandle()->smoother_lag = kLag;
+			ekf->init(0);
+			sensor_simulator.runSeconds(0.1f);
+			ekf->set_in_air_status(false);
+			ekf->set_vehicle_at_rest(true);
+			sensor_simulator.runSeconds(2.f);
+			ekf_wrapper.enableGpsFusion();
+			sensor_simulator.startGps();
+			sensor_simulator.runSeconds(11.f);
+
+			// one backward pass per filter update (100 Hz)
+			const uint64_t n_passes = std::max((uint64_t)(duration_s * 100.f), (uint64_t)1);
+			FixedLagSmoother &smoother = ekf->smoother();
+			uint64_t smoothed = 0;
+
+			const auto start = clock_type::now();
+
+			for (uint64_t i = 0; i < n_passes; i++) {
+				smoothed += smoother.smooth() ? 1 : 0;
+			}
+
+			const auto end = clock_type::now();
+
+			Result result{"smoother/update", n_passes, std::chrono::duration<double, std::nano>(end - start).count() / n_passes};
+			result.counters = {{"lag", (double)kLag}, {"smoothed", (double)smoothed}};
+			return result;
+		}
+	},
+	{
+		"ring_buffer", "RingBuffer search failing at the oldest sample (depth 512), in time order and with one sample out of order",
+		[](float duration_s)
+		{
+			static constexpr uint16_t kDepth = 512;
+
+			// in time order: binary search, one sample out of order: linear scan
+			double ns_per_search[2] {};
+			uint64_t n_searches = 0;
+
+			for (int unsorted = 0; unsorted < 2; unsorted++) {
+				RingBuffer<imuSample> buffer(kDepth);
+				imuSample sample{};
+
+				for (uint16_t i = 0; i < kDepth; i++) {
+					sample.time_us = 1000000 + i * 1000;
+
+					if (unsorted && (i == kDepth - 1)) {
+						sample.time_us = 1000000 + 500;
+					}
+
+					buffer.push(sample);
+				}
+
+				// one search per IMU sample (1 kHz)
+				n_searches = std::max((uint64_t)(duration_s * 1000.f), (uint64_t)1);
+				imuSample pop{};
+				uint64_t found = 0;
+
+				const auto start = clock_type::now();
+
+				for (uint64_t i = 0; i < n_searches; i++) {
+					found += buffer.pop_first_older_than(1000000 - 1 - (i & 1), &pop) ? 1 : 0;
+				}
+
+				const auto end = clock_type::now();
+
+				ns_per_search[unsorted] = std::chrono::duration<double, std::nano>(end - start).count() / n_searches;
+
+				if (found != 0) {
+					fprintf(stderr, "ring_buffer: unexpected sample found\n");
+				}
+			}
+
+			Result result{"ring_buffer/search", n_searches, ns_per_search[0]};
+			result.counters = {{"depth", (double)kDepth}, {"linear_scan_ns", ns_per_search[1]}};
+			return result;
+		}
+	},
+};
+
+struct ProfileRun {
+	const Profile *profile{nullptr};
+	float duration_s{0.f};
+	float clock_overhead_ns{0.f};
+
+	Timing update;                       ///< all Ekf::update() calls
+	Timing predict;                      ///< filter updates without any fusion
+	Timing idle;                         ///< calls only buffering the IMU sample
+	std::map<uint32_t, Timing> fusions;  ///< filter updates by set of fused aid sources (bitmask)
+
+	size_t heap_peak_bytes{0};
+	uint64_t heap_allocations_in_update{0};
+	size_t stack_peak_bytes{0};
+
+	void add(float ns, bool updated, uint32_t fused)
+	{
+		update.add(ns);
+
+		if (!updated) {
+			idle.add(ns);
+
+		} else if (fused == 0) {
+			predict.add(ns);
+
+		} else {
+			fusions[fused].add(ns);
+		}
+	}
+};
+
+struct UpdateRecord {
+	float ns;
+	uint32_t fused; ///< bitmask of the aid sources fused during the update
+	bool updated;
+};
+
+float clockOverheadNs()
+{
+	// median of back to back clock readings
+	std::vector<float> samples(1001);
+
+	for (float &sample : samples) {
+		const auto t0 = clock_type::now();
+		const auto t1 = clock_type::now();
+		sample = std::chrono::duration<float, std::nano>(t1 - t0).count();
+	}
+
+	std::nth_element(samples.begin(), samples.begin() + samples.size() / 2, samples.end());
+	return samples[samples.size() / 2];
+}
+
+void *runProfile(void *arg)
+{
+	ProfileRun &run = *static_cast<ProfileRun *>(arg);
+
+	// preallocated so that the measurement itself doesn't allocate
+	std::vector<UpdateRecord> records;
+	records.reserve((size_t)(run.duration_s * 1000.f) + 1);
+
+	const size_t heap_start = heap_current;
+	heap_peak = heap_start;
+
+	std::shared_ptr<Ekf> ekf = std::make_shared<Ekf>();
+	SensorSimulator sensor_simulator(ekf);
+	EkfWrapper ekf_wrapper(ekf);
+
+	// run briefly to init, then align on ground at rest
+	ekf->init(0);
+	sensor_simulator.runSeconds(0.1f);
+	ekf->set_in_air_status(false);
+	ekf->set_vehicle_at_rest(true);
+	sensor_simulator.runSeconds(7.f);
+
+	// start aiding, take off and settle before measuring
+	run.profile->start(ekf, sensor_simulator, ekf_wrapper);
+	sensor_simulator.runSeconds(11.f);
+	ekf->set_in_air_status(true);
+	ekf->set_vehicle_at_rest(false);
+	sensor_simulator.runSeconds(5.f);
+
+	uint64_t time_last_fuse[kNumAidSources];
+
+	for (size_t i = 0; i < kNumAidSources; i++) {
+		time_last_fuse[i] = kAidSources[i].time_last_fuse(*ekf);
+	}
+
+	sensor_simulator.setEkfUpdateFunction([&]() {
+		const uint64_t allocations = heap_allocations;
+		const auto t0 = clock_type::now();
+		const bool updated = ekf->update();
+		const auto t1 = clock_type::now();
+		run.heap_allocations_in_update += heap_allocations - allocations;
+
+		uint32_t fused = 0;
+
+		for (size_t i = 0; i < kNumAidSources; i++) {
+			const uint64_t t = kAidSources[i].time_last_fuse(*ekf);
+
+			if (t != time_last_fuse[i]) {
+				time_last_fuse[i] = t;
+				fused |= 1u << i;
+			}
+		}
+
+		const float ns = std::chrono::duration<float, std::nano>(t1 - t0).count() - run.clock_overhead_ns;
+		records.push_back({std::max(ns, 0.f), fused, updated});
+
+		return updated;
+	});
+
+	sensor_simulator.runSeconds(run.duration_s);
+	sensor_simulator.setEkfUpdateFunction(nullptr);
+
+	run.heap_peak_bytes = heap_peak - heap_start;
+
+	for (const UpdateRecord &record : records) {
+		run.add(record.ns, record.updated, record.fused);
+	}
+
+	return nullptr;
+}
+
+bool runProfileOnPaintedStack(ProfileRun &run)
+{
+	// run on a caller provided stack painted with a known pattern, the untouched part
+	// at the low end gives the stack high-water mark (the stack grows downwards)
+	static constexpr size_t kStackSize = 1024 * 1024;
+	static constexpr uint8_t kStackPaint = 0xA5;
+
+	uint8_t *stack = static_cast<uint8_t *>(aligned_alloc(4096, kStackSize));
+
+	if (stack == nullptr) {
+		return false;
+	}
+
+	memset(stack, kStackPaint, kStackSize);
+
+	pthread_attr_t attr;
+	pthread_attr_init(&attr);
+	pthread_attr_setstack(&attr, stack, kStackSize);
+
+	pthread_t thread;
+	const bool ok = (pthread_create(&thread, &attr, runProfile, &run) == 0) && (pthread_join(thread, nullptr) == 0);
+	pthread_attr_destroy(&attr);
+
+	size_t untouched = 0;
+
+	while (untouched < kStackSize && stack[untouched] == kStackPaint) {
+		untouched++;
+	}
+
+	run.stack_peak_bytes = kStackSize - untouched;
+
+	free(stack);
+
+	return ok;
+}
+
+std::string fusionName(uint32_t fused)
+{
+	std::string name;
+
+	for (size_t i = 0; i < kNumAidSources; i++) {
+		if (fused & (1u << i)) {
+			if (!name.empty()) {
+				name += "+";
+			}
+
+			name += kAidSources[i].name;
+		}
+	}
+
+	return name;
+}
+
+void collectResults(const ProfileRun &run, std::vector<Result> &results)
+{
+	const std::string prefix = std::string(run.profile->name) + "/";
+
+	Result update{prefix + "update", run.update.count(), run.update.mean()};
+	update.counters = {
+		{"p99_ns", run.update.percentile(0.99f)},
+		{"max_ns", run.update.percentile(1.f)},
+		{"heap_peak_bytes", (double)run.heap_peak_bytes},
+		{"heap_allocations_in_update", (double)run.heap_allocations_in_update},
+		{"stack_peak_bytes", (double)run.stack_peak_bytes},
+	};
+	results.push_back(update);
+
+	results.push_back({prefix + "idle", run.idle.count(), run.idle.mean()});
+	results.push_back({prefix + "predict", run.predict.count(), run.predict.mean()});
+
+	// cost of each fusion is the time above a filter update without fusion
+	for (const auto &fusion : run.fusions) {
+		Result result{prefix + "fuse/" + fusionName(fusion.first), fusion.second.count(), fusion.second.mean()};
+		result.counters = {{"fusion_ns", std::max(fusion.second.mean() - run.predict.mean(), 0.)}};
+		results.push_back(result);
+	}
+}
+
+void printResults(const std::vector<Result> &results)
+{
+	printf("%-64s %12s %12s  %s\n", "Benchmark", "Time", "Iterations", "UserCounters...");
+	printf("%s\n", std::string(116, '-').c_str());
+
+	for (const Result &result : results) {
+		printf("%-64s %9.0f ns %12llu ", result.name.c_str(), result.time_ns, (unsigned long long)result.iterations);
+
+		for (const auto &counter : result.counters) {
+			printf(" %s=%.0f", counter.first.c_str(), counter.second);
+		}
+
+		printf("\n");
+	}
+}
+
+bool writeJson(const std::string &file_name, const char *executable, float duration_s, const std::vector<Result> &results)
+{
+	FILE *file = fopen(file_name.c_str(), "w");
+
+	if (file == nullptr) {
+		fprintf(stderr, "failed to open %s\n", file_name.c_str());
+		return false;
+	}
+
+	char date[32] {};
+	const time_t now = time(nullptr);
+	strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S%z", localtime(&now));
+
+	char host_name[64] {};
+	gethostname(host_name, sizeof(host_name) - 1);
+
+	fprintf(file, "{\n");
+	fprintf(file, "  \"context\": {\n");
+	fprintf(file, "    \"date\": \"%s\",\n", date);
+	fprintf(file, "    \"host_name\": \"%s\",\n", host_name);
+	fprintf(file, "    \"executable\": \"%s\",\n", executable);
+	fprintf(file, "    \"num_cpus\": %ld,\n", sysconf(_SC_NPROCESSORS_ONLN));
+#if defined(NDEBUG)
+	fprintf(file, "    \"library_build_type\": \"release\",\n");
+#else
+	fprintf(file, "    \"library_build_type\": \"debug\",\n");
+#endif
+	fprintf(file, "    \"duration_s\": %.1f\n", (double)duration_s);
+	fprintf(file, "  },\n");
+	fprintf(file, "  \"benchmarks\": [\n");
+
+	for (size_t i = 0; i < results.size(); i++) {
+		const Result &result = results[i];
+		fprintf(file, "    {\n");
+		fprintf(file, "      \"name\": \"%s\",\n", result.name.c_str());
+		fprintf(file, "      \"run_name\": \"%s\",\n", result.name.c_str());
+		fprintf(file, "      \"run_type\": \"iteration\",\n");
+		fprintf(file, "      \"repetitions\": 1,\n");
+		fprintf(file, "      \"repetition_index\": 0,\n");
+		fprintf(file, "      \"threads\": 1,\n");
+		fprintf(file, "      \"iterations\": %llu,\n", (unsigned long long)result.iterations);
+		fprintf(file, "      \"real_time\": %.1f,\n", result.time_ns);
+		fprintf(file, "      \"cpu_time\": %.1f,\n", result.time_ns);
+		fprintf(file, "      \"time_unit\": \"ns\"");
+
+		for (const auto &counter : result.counters) {
+			fprintf(file, ",\n      \"%s\": %.1f", counter.first.c_str(), counter.second);
+		}
+
+		fprintf(file, "\n    }%s\n", (i + 1 < results.size()) ? "," : "");
+	}
+
+	fprintf(file, "  ]\n");
+	fprintf(file, "}\n");
+	fclose(file);
+
+	return true;
+}
+
+// minimal reader for the files written by writeJson(): flat benchmark objects only
+bool readJsonValue(const std::string &json, const std::string &name, const char *key, double &value)
+{
+	const size_t object_start = json.find("\"name\": \"" + name + "\"");
+
+	if (object_start == std::string::npos) {
+		return false;
+	}
+
+	const size_t object_end = json.find('}', object_start);
+	const size_t key_start = json.find(std::string("\"") + key + "\": ", object_start);
+
+	if (key_start == std::string::npos || key_start > object_end) {
+		return false;
+	}
+
+	value = strtod(json.c_str() + key_start + strlen(key) + 4, nullptr);
+	return true;
+}
+
+int compareWithBaseline(const std::string &file_name, const std::vector<Result> &results, float max_regression_percent)
+{
+	std::ifstream file(file_name);
+
+	if (!file) {
+		fprintf(stderr, "failed to open baseline %s\n", file_name.c_str());
+		return -1;
+	}
+
+	std::stringstream buffer;
+	buffer << file.rdbuf();
+	const std::string json = buffer.str();
+
+	int regressions = 0;
+
+	printf("\nComparison against %s (max regression %.1f%%)\n", file_name.c_str(), (double)max_regression_percent);
+
+	for (const Result &result : results) {
+		// only the totals are compared, the fusion breakdown is informational
+		if (result.name.size() < 7 || result.name.compare(result.name.size() - 7, 7, "/update") != 0) {
+			continue;
+		}
+
+		auto compare = [&](const char *key, double value) {
+			double baseline = 0.;
+
+			if (!readJsonValue(json, result.name, key, baseline)) {
+				printf("%-32s %-18s not in baseline\n", result.name.c_str(), key);
+				return;
+			}
+
+			const double change_percent = (baseline > 0.) ? 100. * (value - baseline) / baseline : 0.;
+			const bool regression = change_percent > max_regression_percent;
+			regressions += regression ? 1 : 0;
+
+			printf("%-32s %-18s %12.0f -> %12.0f  %+6.1f%%%s\n", result.name.c_str(), key, baseline, value, change_percent,
+			       regression ? "  REGRESSION" : "");
+		};
+
+		compare("real_time", result.time_ns);
+
+		for (const auto &counter : result.counters) {
+			if (counter.first == "heap_peak_bytes" || counter.first == "stack_peak_bytes") {
+				compare(counter.first.c_str(), counter.second);
+			}
+		}
+	}
+
+	return regressions;
+}
+
+void usage(const char *name)
+{
+	printf("usage: %s [-t <duration s>] [-p <profile>] [-o <json file>] [-b <baseline json file>] [-r <max regression %%>]\n",
+	       name);
+	printf("\n");
+	printf(" -t <duration s>       simulated duration measured per profile and component (default: 60)\n");
+	printf(" -p <profile>          run only the given profile or component (default: all)\n");
+	printf(" -o <json file>        write the results in the Google Benchmark JSON format\n");
+	printf(" -b <baseline file>    compare against a previous JSON result, exit with 1 on regression\n");
+	printf(" -r <max regression %%> allowed increase of time and memory high-water marks (default: 10)\n");
+	printf("\n");
+	printf("profiles:\n");
+
+	for (const Profile &profile : kProfiles) {
+		printf(" %-20s %s\n", profile.name, profile.description);
+	}
+
+	printf("\n");
+	printf("components:\n");
+
+	for (const Component &component : kComponents) {
+		printf(" %-20s %s\n", component.name, component.description);
+	}
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+	float duration_s = 60.f;
+	float max_regression_percent = 10.f;
+	std::string profile_name;
+	std::string output_file;
+	std::string baseline_file;
+
+	int ch;
+
+	while ((ch = getopt(argc, argv, "t:p:o:b:r:h")) != -1) {
+		switch (ch) {
+		case 't':
+			duration_s = strtof(optarg, nullptr);
+			break;
+
+		case 'p':
+			profile_name = optarg;
+			break;
+
+		case 'o':
+			output_file = optarg;
+			break;
+
+		case 'b':
+			baseline_file = optarg;
+			break;
+
+		case 'r':
+			max_regression_percent = strtof(optarg, nullptr);
+			break;
+
+		default:
+			usage(argv[0]);
+			return 1;
+		}
+	}
+
+	if (duration_s <= 0.f) {
+		usage(argv[0]);
+		return 1;
+	}
+
+	const float clock_overhead_ns = clockOverheadNs();
+	std::vector<Result> results;
+
+	for (const Profile &profile : kProfiles) {
+		if (!profile_name.empty() && profile_name != profile.name) {
+			continue;
+		}
+
+		ProfileRun run;
+		run.profile = &profile;
+		run.duration_s = duration_s;
+		run.clock_overhead_ns = clock_overhead_ns;
+
+		if (!runProfileOnPaintedStack(run)) {
+			fprintf(stderr, "failed to run profile %s\n", profile.name);
+			return 1;
+		}
+
+		collectResults(run, results);
+	}
+
+	for (const Component &component : kComponents) {
+		if (!profile_name.empty() && profile_name != component.name) {
+			continue;
+		}
+
+		results.push_back(component.run(duration_s));
+	}
+
+	if (results.empty()) {
+		fprintf(stderr, "unknown profile %s\n", profile_name.c_str());
+		usage(argv[0]);
+		return 1;
+	}
+
+	printf("%s, %.0f s per profile, clock overhead %.0f ns (subtracted)\n", argv[0], (double)duration_s,
+	       (double)clock_overhead_ns);
+	printResults(results);
+
+	if (!output_file.empty() && !writeJson(output_file, argv[0], duration_s, results)) {
+		return 1;
+	}
+
+	if (!baseline_file.empty()) {
+		const int regressions = compareWithBaseline(baseline_file, results, max_regression_percent);
+
+		if (regressions != 0) {
+			return 1;
+		}
+	}
+
+	return 0;
+}
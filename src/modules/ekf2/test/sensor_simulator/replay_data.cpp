@@ -0,0 +1,157 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include "replay_data.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+static bool parseSensorType(const char *name, ReplayData::measurement_t &type)
+{
+	static constexpr struct {
+		const char *name;
+		ReplayData::measurement_t type;
+	} sensor_types[] = {
+		{"imu",      ReplayData::measurement_t::IMU},
+		{"mag",      ReplayData::measurement_t::MAG},
+		{"baro",     ReplayData::measurement_t::BARO},
+		{"gps",      ReplayData::measurement_t::GPS},
+		{"airspeed", ReplayData::measurement_t::AIRSPEED},
+		{"range",    ReplayData::measurement_t::RANGE},
+		{"flow",     ReplayData::measurement_t::FLOW},
+		{"vio",      ReplayData::measurement_t::VISION},
+		{"landed",   ReplayData::measurement_t::LANDING_STATUS},
+	};
+
+	for (const auto &sensor_type : sensor_types) {
+		if (strcmp(name, sensor_type.name) == 0) {
+			type = sensor_type.type;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool ReplayData::loadFromFile(const std::string &file_name)
+{
+	std::ifstream file(file_name);
+
+	if (!file.is_open()) {
+		std::cout << "Could not open replay data file " << file_name << std::endl;
+		return false;
+	}
+
+	std::string line;
+
+	while (std::getline(file, line)) {
+		if (line.empty()) {
+			continue;
+		}
+
+		char *cursor = &line[0];
+		char *end = nullptr;
+
+		const uint64_t timestamp = strtoull(cursor, &end, 10);
+
+		if (end == cursor || *end != ',') {
+			std::cout << "Malformed replay data line: " << line << std::endl;
+			return false;
+		}
+
+		if (!_timestamp.empty() && timestamp < _timestamp.back()) {
+			std::cout << "Timestamps not sorted ascendingly" << std::endl;
+			return false;
+		}
+
+		cursor = end + 1;
+		char *type_end = strchr(cursor, ',');
+
+		if (type_end) {
+			*type_end = '\0';
+		}
+
+		measurement_t type;
+
+		if (!parseSensorType(cursor, type)) {
+			std::cout << "Sensor type in file unknown" << std::endl;
+			return false;
+		}
+
+		_timestamp.push_back(timestamp);
+		_type.push_back(type);
+		_type_count[static_cast<int>(type)]++;
+
+		const size_t values_offset = _values.size();
+		_values.resize(values_offset + MAX_VALUES_PER_SAMPLE, 0.0);
+
+		int i = 0;
+		cursor = type_end ? type_end + 1 : nullptr;
+
+		while (cursor && *cursor != '\0') {
+			if (*cursor == ',') {
+				// empty field
+				cursor++;
+				continue;
+			}
+
+			if (i >= MAX_VALUES_PER_SAMPLE) {
+				std::cout << "sensor data bigger than expected" << std::endl;
+				return false;
+			}
+
+			_values[values_offset + i] = strtod(cursor, &end);
+
+			if (end == cursor) {
+				std::cout << "Malformed replay data line: " << line << std::endl;
+				return false;
+			}
+
+			i++;
+			cursor = (*end == ',') ? end + 1 : end;
+
+			if (*end != ',' && *end != '\0' && *end != '\r') {
+				std::cout << "Malformed replay data line: " << line << std::endl;
+				return false;
+			}
+
+			if (*end == '\r') {
+				break;
+			}
+		}
+	}
+
+	return true;
+}
@@ -0,0 +1,85 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * Sensor replay data in columnar layout.
+ * The data is loaded once from a sensor data file (see convertULogToSensorData.py)
+ * and can then be shared read-only between any number of SensorSimulator instances,
+ * e.g. to replay the same log with different parameter sets in parallel.
+ */
+#ifndef EKF_REPLAY_DATA_H
+#define EKF_REPLAY_DATA_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class ReplayData
+{
+public:
+	enum class measurement_t : uint8_t {IMU, MAG, BARO, GPS, AIRSPEED, RANGE, FLOW, VISION, LANDING_STATUS, COUNT};
+
+	static constexpr int MAX_VALUES_PER_SAMPLE = 10;
+
+	ReplayData() = default;
+	~ReplayData() = default;
+
+	/**
+	 * Load a sensor data file. Lines are of the form "timestamp,sensor_type,value0,value1,...".
+	 * @return false if the file could not be read or is malformed
+	 */
+	bool loadFromFile(const std::string &file_name);
+
+	size_t size() const { return _timestamp.size(); }
+	bool empty() const { return _timestamp.empty(); }
+
+	uint64_t timestamp(size_t index) const { return _timestamp[index]; }
+	measurement_t type(size_t index) const { return _type[index]; }
+
+	/** values of sample index, valid for MAX_VALUES_PER_SAMPLE entries (missing values are 0) */
+	const double *values(size_t index) const { return &_values[index * MAX_VALUES_PER_SAMPLE]; }
+
+	uint64_t startTime() const { return empty() ? 0 : _timestamp.front(); }
+	uint64_t endTime() const { return empty() ? 0 : _timestamp.back(); }
+
+	/** true if the data contains at least one sample of the given type */
+	bool contains(measurement_t type) const { return _type_count[static_cast<int>(type)] > 0; }
+
+private:
+	std::vector<uint64_t> _timestamp{};
+	std::vector<measurement_t> _type{};
+	std::vector<double> _values{}; ///< MAX_VALUES_PER_SAMPLE values per sample
+
+	size_t _type_count[static_cast<int>(measurement_t::COUNT)] {};
+};
+#endif // !EKF_REPLAY_DATA_H
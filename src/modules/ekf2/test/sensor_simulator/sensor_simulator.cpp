@@ -25,92 +25,50 @@ SensorSimulator::SensorSimulator(std::shared_ptr<Ekf> ekf):
 
 void SensorSimulator::loadSensorDataFromFile(std::string file_name)
 {
-	std::ifstream file(file_name);
-	std::string line;
+	auto replay_data = std::make_shared<ReplayData>();
 
-	while (!file.eof()) {
-		std::string timestamp;
-		std::string sensor_type;
-		std::string sensor_data;
-		sensor_info sensor_sample;
-
-		getline(file, timestamp, ',');
-
-		if (!timestamp.compare("")) { // empty line at end of file
-			break;
-		}
-
-		sensor_sample.timestamp = std::stoul(timestamp);
-
-		if (_replay_data.size() > 0) {
-			sensor_info last_sample = _replay_data.back();
-
-			if (sensor_sample.timestamp < last_sample.timestamp) {
-				std::cout << "Timestamps not sorted ascendingly" << std::endl;
-				system_exit(-1);
-			}
-		}
-
-		getline(file, sensor_type, ',');
-
-		if (!sensor_type.compare("imu")) {
-			sensor_sample.sensor_type = sensor_info::measurement_t::IMU;
-
-		} else if (!sensor_type.compare("mag")) {
-			sensor_sample.sensor_type = sensor_info::measurement_t::MAG;
-
-		} else if (!sensor_type.compare("baro")) {
-			sensor_sample.sensor_type = sensor_info::measurement_t::BARO;
-
-		} else if (!sensor_type.compare("gps")) {
-			sensor_sample.sensor_type = sensor_info::measurement_t::GPS;
-
-		} else if (!sensor_type.compare("airspeed")) {
-			sensor_sample.sensor_type = sensor_info::measurement_t::AIRSPEED;
-
-		} else if (!sensor_type.compare("range")) {
-			sensor_sample.sensor_type = sensor_info::measurement_t::RANGE;
-
-		} else if (!sensor_type.compare("flow")) {
-			sensor_sample.sensor_type = sensor_info::measurement_t::FLOW;
-
-		} else if (!sensor_type.compare("vio")) {
-			sensor_sample.sensor_type = sensor_info::measurement_t::VISION;
+	if (!replay_data->loadFromFile(file_name)) {
+		system_exit(-1);
+	}
 
-		} else if (!sensor_type.compare("landed")) {
-			sensor_sample.sensor_type = sensor_info::measurement_t::LANDING_STATUS;
+	setReplayData(replay_data);
+}
 
-		} else {
-			std::cout << "Sensor type in file unknown" << std::endl;
-			system_exit(-1);
-		}
+void SensorSimulator::setReplayData(std::shared_ptr<const ReplayData> replay_data)
+{
+	_replay_data = replay_data;
+	_current_replay_data_index = 0;
+}
 
-		getline(file, sensor_data);
-		std::stringstream ss(sensor_data);
-		int8_t i = 0;
+void SensorSimulator::startReplaySensors()
+{
+	if (!_replay_data) {
+		return;
+	}
 
-		while (ss.good()) {
-			if (i >= 10) {
-				std::cout << "sensor data bigger than expected" << std::endl;
-				system_exit(-1);
-			}
+	if (!_replay_data->contains(ReplayData::measurement_t::MAG)) {
+		_mag.stop();
+	}
 
-			std::string value_string;
-			getline(ss, value_string, ',');
+	if (!_replay_data->contains(ReplayData::measurement_t::BARO)) {
+		stopBaro();
+	}
 
-			if (!value_string.compare("")) {
-				continue;
-			}
+	if (_replay_data->contains(ReplayData::measurement_t::GPS)) {
+		startGps();
+	}
 
-			sensor_sample.sensor_data[i] = std::stod(value_string);
-			i++;
-		}
+	if (_replay_data->contains(ReplayData::measurement_t::AIRSPEED)) {
+		startAirspeedSensor();
+	}
 
-		_replay_data.emplace_back(sensor_sample);
+	if (_replay_data->contains(ReplayData::measurement_t::RANGE)) {
+		startRangeFinder();
 	}
 
-	file.close();
-	_has_replay_data = true;
+	if (_replay_data->contains(ReplayData::measurement_t::FLOW)) {
+		startFlow();
+	}
 }
 
 void SensorSimulator::setSensorRateToDefault()
@@ -164,7 +122,7 @@ void SensorSimulator::runMicroseconds(uint32_t duration)
 			}
 
 			// Update at IMU rate
-			_ekf->update();
+			updateEkf();
 		}
 	}
 }
@@ -188,7 +146,7 @@ void SensorSimulator::runReplaySeconds(float duration_seconds)
 
 void SensorSimulator::runReplayMicroseconds(uint32_t duration)
 {
-	if (!_has_replay_data) {
+	if (!_replay_data) {
 		std::cout << "Can not run replay without replay data" << std::endl;
 		system_exit(-1);
 	}
@@ -207,90 +165,82 @@ void SensorSimulator::runReplayMicroseconds(uint32_t duration)
 				_ekf->set_vehicle_at_rest(false);
 			}
 
-			_ekf->update();
+			updateEkf();
 		}
 	}
 }
 
 void SensorSimulator::setSensorDataFromReplayData()
 {
-	if (_replay_data.size() > 0) {
-		sensor_info sample = _replay_data[_current_replay_data_index];
-
-		while (sample.timestamp < _time) {
-			setSingleReplaySample(sample);
-
-			if (_current_replay_data_index < _replay_data.size()) {
-				_current_replay_data_index ++;
-
-			} else {
-				break;
-			}
-
-			sample = _replay_data[_current_replay_data_index];
-		}
-
-	} else {
+	if (_replay_data->empty()) {
 		std::cerr << "Loaded replay data empty. Likely could not load replay data" << std::endl;
 		system_exit(-1);
 	}
+
+	while (_current_replay_data_index < _replay_data->size()
+	       && _replay_data->timestamp(_current_replay_data_index) < _time) {
+
+		setSingleReplaySample(_replay_data->type(_current_replay_data_index),
+				      _replay_data->values(_current_replay_data_index));
+		_current_replay_data_index++;
+	}
 }
 
-void SensorSimulator::setSingleReplaySample(const sensor_info &sample)
+void SensorSimulator::setSingleReplaySample(ReplayData::measurement_t type, const double *sensor_data)
 {
-	if (sample.sensor_type == sensor_info::measurement_t::IMU) {
-		Vector3f accel{(float) sample.sensor_data[0],
-			       (float) sample.sensor_data[1],
-			       (float) sample.sensor_data[2]};
-		Vector3f gyro{(float) sample.sensor_data[3],
-			      (float) sample.sensor_data[4],
-			      (float) sample.sensor_data[5]};
+	if (type == ReplayData::measurement_t::IMU) {
+		Vector3f accel{(float) sensor_data[0],
+			       (float) sensor_data[1],
+			       (float) sensor_data[2]};
+		Vector3f gyro{(float) sensor_data[3],
+			      (float) sensor_data[4],
+			      (float) sensor_data[5]};
 		_imu.setData(accel, gyro);
 
-	} else if (sample.sensor_type == sensor_info::measurement_t::MAG) {
-		Vector3f mag{(float) sample.sensor_data[0],
-			     (float) sample.sensor_data[1],
-			     (float) sample.sensor_data[2]};
+	} else if (type == ReplayData::measurement_t::MAG) {
+		Vector3f mag{(float) sensor_data[0],
+			     (float) sensor_data[1],
+			     (float) sensor_data[2]};
 		_mag.setData(mag);
 
-	} else if (sample.sensor_type == sensor_info::measurement_t::BARO) {
-		_baro.setData((float) sample.sensor_data[0]);
+	} else if (type == ReplayData::measurement_t::BARO) {
+		_baro.setData((float) sensor_data[0]);
 
-	} else if (sample.sensor_type == sensor_info::measurement_t::GPS) {
-		_gps.setAltitude((int32_t) sample.sensor_data[0]);
-		_gps.setLatitude((int32_t) sample.sensor_data[1]);
-		_gps.setLongitude((int32_t) sample.sensor_data[2]);
-		_gps.setVelocity(Vector3f((float) sample.sensor_data[3],
-					  (float) sample.sensor_data[4],
-					  (float) sample.sensor_data[5]));
+	} else if (type == ReplayData::measurement_t::GPS) {
+		_gps.setAltitude((int32_t) sensor_data[0]);
+		_gps.setLatitude((int32_t) sensor_data[1]);
+		_gps.setLongitude((int32_t) sensor_data[2]);
+		_gps.setVelocity(Vector3f((float) sensor_data[3],
+					  (float) sensor_data[4],
+					  (float) sensor_data[5]));
 
-	} else if (sample.sensor_type == sensor_info::measurement_t::AIRSPEED) {
-		_airspeed.setData((float) sample.sensor_data[0], (float) sample.sensor_data[1]);
+	} else if (type == ReplayData::measurement_t::AIRSPEED) {
+		_airspeed.setData((float) sensor_data[0], (float) sensor_data[1]);
 
-	} else if (sample.sensor_type == sensor_info::measurement_t::RANGE) {
-		_rng.setData((float) sample.sensor_data[0], (float) sample.sensor_data[1]);
+	} else if (type == ReplayData::measurement_t::RANGE) {
+		_rng.setData((float) sensor_data[0], (float) sensor_data[1]);
 
-	} else if (sample.sensor_type == sensor_info::measurement_t::FLOW) {
+	} else if (type == ReplayData::measurement_t::FLOW) {
 		flowSample flow_sample;
-		flow_sample.flow_rate = Vector2f(sample.sensor_data[0],
-						 sample.sensor_data[1]);
-		flow_sample.gyro_rate = Vector3f(sample.sensor_data[2],
-						 sample.sensor_data[3],
-						 sample.sensor_data[4]);
-		flow_sample.quality = sample.sensor_data[5];
+		flow_sample.flow_rate = Vector2f(sensor_data[0],
+						 sensor_data[1]);
+		flow_sample.gyro_rate = Vector3f(sensor_data[2],
+						 sensor_data[3],
+						 sensor_data[4]);
+		flow_sample.quality = sensor_data[5];
 		_flow.setData(flow_sample);
 
-	} else if (sample.sensor_type == sensor_info::measurement_t::VISION) {
+	} else if (type == ReplayData::measurement_t::VISION) {
 		// sensor not yet implemented
 
 		// extVisionSample vision_sample;
 		// vision_sample.pos;
 		// vision_sample.quat;
 		// vision_sample.vel;
-		// _vio.setData((float) sample.sensor_data[0], (float) sample.sensor_data[1]);
+		// _vio.setData((float) sensor_data[0], (float) sensor_data[1]);
 
-	} else if (sample.sensor_type == sensor_info::measurement_t::LANDING_STATUS) {
-		bool landed = std::abs(sample.sensor_data[0]) <= 0;
+	} else if (type == ReplayData::measurement_t::LANDING_STATUS) {
+		bool landed = std::abs(sensor_data[0]) <= 0;
 		_ekf->set_in_air_status(!landed);
 
 	} else {
@@ -334,7 +284,7 @@ void SensorSimulator::runTrajectoryMicroseconds(uint32_t duration)
 				_ekf->set_vehicle_at_rest(false);
 			}
 
-			_ekf->update();
+			updateEkf();
 		}
 	}
 }
@@ -43,6 +43,7 @@
 #ifndef EKF_SENSOR_SIMULATOR_H
 #define EKF_SENSOR_SIMULATOR_H
 
+#include <functional>
 #include <memory>
 #include <fstream>
 #include <iostream>
@@ -59,17 +60,11 @@
 #include "range_finder.h"
 #include "vio.h"
 #include "airspeed.h"
+#include "replay_data.h"
 #include "EKF/ekf.h"
 
 using namespace sensor_simulator::sensor;
 
-struct sensor_info {
-	uint64_t timestamp{};
-	enum class measurement_t {IMU, MAG, BARO, GPS, AIRSPEED, RANGE, FLOW, VISION, LANDING_STATUS} sensor_type =
-		measurement_t::IMU;
-	std::array<double, 10> sensor_data{};
-};
-
 class SensorSimulator
 {
 
@@ -119,6 +114,23 @@ public:
 
 	void loadSensorDataFromFile(std::string filename);
 
+	/**
+	 * Use already loaded replay data, which can be shared with other simulator instances
+	 */
+	void setReplayData(std::shared_ptr<const ReplayData> replay_data);
+
+	/**
+	 * Start the sensors that have samples in the replay data and stop the ones that have none
+	 */
+	void startReplaySensors();
+
+	bool replayFinished() const { return !_replay_data || _current_replay_data_index >= _replay_data->size(); }
+
+	/**
+	 * Call the given function instead of Ekf::update() at IMU rate, e.g. to time each update
+	 */
+	void setEkfUpdateFunction(std::function<bool()> update) { _ekf_update = std::move(update); }
+
 	Airspeed    _airspeed;
 	Baro        _baro;
 	Flow        _flow;
@@ -134,18 +146,18 @@ private:
 	void setSensorDataToDefault();
 	void setSensorDataFromReplayData();
 	void setSensorRateToDefault();
-	void setSingleReplaySample(const sensor_info &sample);
+	void setSingleReplaySample(ReplayData::measurement_t type, const double *sensor_data);
 	void setSensorDataFromTrajectory();
 	void startBasicSensor();
 	void updateSensors();
+	bool updateEkf() { return _ekf_update ? _ekf_update() : _ekf->update(); }
 
 	std::shared_ptr<Ekf> _ekf{nullptr};
+	std::function<bool()> _ekf_update{};
 
-	std::vector<sensor_info> _replay_data{};
-
-	bool _has_replay_data{false};
+	std::shared_ptr<const ReplayData> _replay_data{nullptr};
 
-	uint64_t _current_replay_data_index{0};
+	size_t _current_replay_data_index{0};
 	uint64_t _time{0}; // microseconds
 
 	Dcmf _R_body_to_world{};
@@ -0,0 +1,148 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <memory>
+#include "EKF/ekf.h"
+#include "batch_replay/batch_replay.h"
+
+class EkfBatchReplayTest : public ::testing::Test
+{
+public:
+	void SetUp() override
+	{
+		ASSERT_TRUE(_replay_data->loadFromFile(TEST_DATA_PATH"/replay_data/iris_gps.csv"));
+	}
+
+	std::shared_ptr<ReplayData> _replay_data{std::make_shared<ReplayData>()};
+};
+
+TEST_F(EkfBatchReplayTest, setParameter)
+{
+	parameters params{};
+	EXPECT_TRUE(BatchReplay::setParameter(params, "EKF2_GPS_P_GATE", 2.5f));
+	EXPECT_FLOAT_EQ(params.gps_pos_innov_gate, 2.5f);
+
+	EXPECT_TRUE(BatchReplay::setParameter(params, "EKF2_GPS_CTRL", 3.f));
+	EXPECT_EQ(params.gnss_ctrl, 3);
+
+	EXPECT_TRUE(BatchReplay::setParameter(params, "EKF2_SMOOTH_LAG", 4.f));
+	EXPECT_EQ(params.smoother_lag, 4);
+
+	EXPECT_FALSE(BatchReplay::setParameter(params, "EKF2_DOES_NOT_EXIST", 1.f));
+}
+
+TEST_F(EkfBatchReplayTest, unknownParameter)
+{
+	BatchReplay batch_replay(_replay_data);
+	batch_replay.addParameterSet({"invalid", {{"EKF2_DOES_NOT_EXIST", 1.f}}});
+	batch_replay.run(1, 1.f);
+
+	ASSERT_EQ(batch_replay.results().size(), 1u);
+	EXPECT_FALSE(batch_replay.results()[0].valid);
+}
+
+TEST_F(EkfBatchReplayTest, parallelMatchesSerial)
+{
+	// GIVEN: several parameter sets replayed serially and in parallel
+	BatchReplay serial(_replay_data);
+	BatchReplay parallel(_replay_data);
+
+	const ParameterSet parameter_sets[] = {
+		{"default", {}},
+		{"tight_gate", {{"EKF2_GPS_P_GATE", 1.f}, {"EKF2_GPS_V_GATE", 1.f}}},
+		{"noisy_baro", {{"EKF2_BARO_NOISE", 10.f}}},
+		{"default_2", {}},
+	};
+
+	for (const auto &parameter_set : parameter_sets) {
+		serial.addParameterSet(parameter_set);
+		parallel.addParameterSet(parameter_set);
+	}
+
+	serial.run(1, 20.f);
+	parallel.run(4, 20.f);
+
+	// THEN: every filter instance is independent of the others
+	ASSERT_EQ(serial.results().size(), parallel.results().size());
+
+	for (size_t i = 0; i < serial.results().size(); i++) {
+		const BatchReplayResult &a = serial.results()[i];
+		const BatchReplayResult &b = parallel.results()[i];
+
+		EXPECT_TRUE(a.valid);
+		EXPECT_TRUE(a.tilt_aligned);
+		EXPECT_EQ(a.name, b.name);
+		ASSERT_EQ(a.innovations.size(), b.innovations.size());
+
+		for (size_t k = 0; k < a.innovations.size(); k++) {
+			EXPECT_EQ(a.innovations[k].samples, b.innovations[k].samples) << a.name << " " << a.innovations[k].aid_source;
+			EXPECT_EQ(a.innovations[k].fused, b.innovations[k].fused) << a.name << " " << a.innovations[k].aid_source;
+			EXPECT_DOUBLE_EQ(a.innovations[k].innovation_sq_sum, b.innovations[k].innovation_sq_sum);
+		}
+	}
+
+	// AND: identical parameter sets give identical results
+	const BatchReplayResult &first = parallel.results()[0];
+	const BatchReplayResult &last = parallel.results()[3];
+
+	for (size_t k = 0; k < first.innovations.size(); k++) {
+		EXPECT_EQ(first.innovations[k].samples, last.innovations[k].samples);
+		EXPECT_DOUBLE_EQ(first.innovations[k].test_ratio_sum, last.innovations[k].test_ratio_sum);
+	}
+}
+
+TEST_F(EkfBatchReplayTest, fusesReplayedSensors)
+{
+	BatchReplay batch_replay(_replay_data);
+	batch_replay.addParameterSet({"default", {}});
+	batch_replay.run(1, 20.f);
+
+	const BatchReplayResult &result = batch_replay.results()[0];
+	ASSERT_TRUE(result.valid);
+
+	bool baro_fused = false;
+	bool gnss_fused = false;
+
+	for (const auto &stats : result.innovations) {
+		if (strcmp(stats.aid_source, "baro_hgt") == 0) {
+			baro_fused = stats.fused > 0;
+
+		} else if (strcmp(stats.aid_source, "gnss_vel") == 0) {
+			gnss_fused = stats.fused > 0;
+		}
+	}
+
+	EXPECT_TRUE(baro_fused);
+	EXPECT_TRUE(gnss_fused);
+}
@@ -0,0 +1,145 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * Test the fixed-lag smoother of the delayed horizon velocity and position states
+ */
+
+#include <gtest/gtest.h>
+#include "EKF/ekf.h"
+#include "sensor_simulator/sensor_simulator.h"
+#include "sensor_simulator/ekf_wrapper.h"
+
+class EkfFixedLagSmootherTest : public ::testing::Test
+{
+public:
+
+	EkfFixedLagSmootherTest(): ::testing::Test(),
+		_ekf{std::make_shared<Ekf>()},
+		_sensor_simulator(_ekf),
+		_ekf_wrapper(_ekf) {};
+
+	std::shared_ptr<Ekf> _ekf;
+	SensorSimulator _sensor_simulator;
+	EkfWrapper _ekf_wrapper;
+
+	static constexpr int kLag = 20;
+
+	void SetUp() override
+	{
+		_ekf->getParamHandle()->smoother_lag = kLag;
+
+		_ekf->init(0);
+		_sensor_simulator.runSeconds(0.1);
+		_ekf->set_in_air_status(false);
+		_ekf->set_vehicle_at_rest(true);
+
+		_sensor_simulator.runSeconds(2);
+		_ekf_wrapper.enableGpsFusion();
+		_sensor_simulator.startGps();
+		_sensor_simulator.runSeconds(11);
+	}
+};
+
+TEST_F(EkfFixedLagSmootherTest, smoothedTrajectory)
+{
+	FixedLagSmoother &smoother = _ekf->smoother();
+	ASSERT_TRUE(smoother.enabled());
+
+	// WHEN: the vehicle moves
+	const Vector3f simulated_velocity(1.f, -0.5f, 0.f);
+	_ekf->set_in_air_status(true);
+	_ekf->set_vehicle_at_rest(false);
+	_sensor_simulator.setTrajectoryTargetVelocity(simulated_velocity);
+	_sensor_simulator.runTrajectorySeconds(10);
+
+	// THEN: the smoothed state is available with the configured lag behind the fusion time horizon
+	ASSERT_TRUE(smoother.smooth());
+	const FixedLagSmoother::Output &out = smoother.output();
+	const float dt = _ekf->get_dt_ekf_avg();
+	EXPECT_NEAR(smoother.lagTime(), (kLag - 1) * dt, 2.f * dt);
+	EXPECT_EQ(smoother.lagTime(), 1e-6f * (_ekf->time_delayed_us() - out.time_us));
+
+	// AND: it follows the filtered trajectory, delayed by the lag
+	const Vector3f vel = _ekf->getVelocity();
+	EXPECT_TRUE(isEqual(out.vel, vel, 0.05f));
+	const Vector3f pos_expected = _ekf->getPosition() - vel * smoother.lagTime();
+	EXPECT_TRUE(isEqual(Vector2f(out.pos.xy()), Vector2f(pos_expected.xy()), 0.05f));
+
+	// AND: the smoothed uncertainty is not larger than the filtered one
+	const Vector3f vel_var = _ekf->getVelocityVariance();
+	const Vector3f pos_var = _ekf->getPositionVariance();
+
+	for (int i = 0; i < 3; i++) {
+		EXPECT_GT(out.vel_var(i), 0.f);
+		EXPECT_LT(out.vel_var(i), vel_var(i));
+		EXPECT_GT(out.pos_var(i), 0.f);
+		EXPECT_LT(out.pos_var(i), pos_var(i));
+	}
+}
+
+TEST_F(EkfFixedLagSmootherTest, disable)
+{
+	// WHEN: the smoother is disabled
+	_ekf->getParamHandle()->smoother_lag = 0;
+	_sensor_simulator.runSeconds(0.1);
+
+	// THEN: the history is released and no output is produced
+	EXPECT_FALSE(_ekf->smoother().enabled());
+	EXPECT_FALSE(_ekf->smoother().smooth());
+
+	// BUT WHEN: it is enabled again
+	_ekf->getParamHandle()->smoother_lag = kLag;
+	_sensor_simulator.runSeconds(kLag * 0.01f + 0.1f);
+
+	// THEN: a smoothed state is produced once the history is full
+	EXPECT_TRUE(_ekf->smoother().enabled());
+	EXPECT_TRUE(_ekf->smoother().smooth());
+}
+
+TEST_F(EkfFixedLagSmootherTest, lagOfOne)
+{
+	// WHEN: the history only holds the newest filter update
+	_ekf->getParamHandle()->smoother_lag = 1;
+	_sensor_simulator.runSeconds(0.1);
+
+	// THEN: the filtered states at the fusion time horizon are output without delay
+	FixedLagSmoother &smoother = _ekf->smoother();
+	EXPECT_TRUE(smoother.enabled());
+	EXPECT_EQ(smoother.lag(), 1);
+	ASSERT_TRUE(smoother.smooth());
+	EXPECT_EQ(smoother.output().time_us, _ekf->time_delayed_us());
+	EXPECT_FLOAT_EQ(smoother.lagTime(), 0.f);
+	EXPECT_TRUE(isEqual(smoother.output().vel, _ekf->getVelocity(), 1e-3f));
+}
@@ -158,3 +158,86 @@ TEST_F(EkfRingBufferTest, reallocateBuffer)
 	EXPECT_EQ(3, _buffer->get_length());
 
 }
+
+TEST_F(EkfRingBufferTest, outOfOrderSamples)
+{
+	ASSERT_EQ(true, _buffer->allocate(3));
+
+	// GIVEN: samples that are not pushed in time order
+	sample a{}, b{}, c{};
+	a.time_us = 1000000;
+	b.time_us = 1020000;
+	c.time_us = 1050000;
+
+	_buffer->push(a);
+	_buffer->push(c);
+	_buffer->push(b);
+
+	// WHEN: asking for a sample
+	// THEN: the first one from the head that is older is returned
+	sample pop = {};
+	EXPECT_EQ(true, _buffer->pop_first_older_than(1030000, &pop));
+	EXPECT_EQ(b.time_us, pop.time_us);
+	EXPECT_EQ(0, _buffer->count());
+
+	// AND: the buffer is searched by timestamp again once emptied
+	_buffer->push(a);
+	_buffer->push(b);
+	_buffer->push(c);
+	EXPECT_EQ(true, _buffer->pop_first_older_than(1030000, &pop));
+	EXPECT_EQ(b.time_us, pop.time_us);
+	EXPECT_EQ(1, _buffer->count());
+}
+
+TEST_F(EkfRingBufferTest, largeBuffer)
+{
+	// GIVEN: a buffer longer than 255 samples
+	const uint16_t length = 1000;
+	ASSERT_EQ(true, _buffer->allocate(length));
+	EXPECT_EQ(length, _buffer->get_length());
+
+	// WHEN: it gets filled with more samples than it can hold
+	sample s{};
+
+	for (uint16_t i = 0; i < length + 10; i++) {
+		s.time_us = 1000000 + i * 1000;
+		_buffer->push(s);
+	}
+
+	// THEN: the oldest samples are overwritten
+	EXPECT_EQ(length, _buffer->count());
+	EXPECT_EQ(1000000u + 10 * 1000, _buffer->get_oldest().time_us);
+	EXPECT_EQ(1000000u + (length + 9) * 1000, _buffer->get_newest().time_us);
+
+	// AND: the newest sample that is not newer than the requested time is returned
+	sample pop = {};
+	EXPECT_EQ(true, _buffer->pop_first_older_than(1000000 + 500 * 1000 + 500, &pop));
+	EXPECT_EQ(1000000u + 500 * 1000, pop.time_us);
+
+	// AND: it is removed together with all the older samples
+	EXPECT_EQ(length + 9 - 500, _buffer->count());
+	EXPECT_EQ(1000000u + 501 * 1000, _buffer->get_oldest().time_us);
+}
+
+TEST_F(EkfRingBufferTest, discardOlderThan)
+{
+	ASSERT_EQ(true, _buffer->allocate(5));
+	_buffer->push(_x);
+	_buffer->push(_y);
+	_buffer->push(_z);
+
+	// WHEN: discarding samples older than a timestamp
+	// THEN: only the older samples are removed
+	EXPECT_EQ(0, _buffer->discard_older_than(_x.time_us));
+	EXPECT_EQ(2, _buffer->discard_older_than(_y.time_us + 1));
+	EXPECT_EQ(1, _buffer->count());
+	EXPECT_EQ(_z.time_us, _buffer->get_oldest().time_us);
+
+	// WHEN: all the samples are older
+	// THEN: the buffer is empty
+	EXPECT_EQ(1, _buffer->discard_older_than(_z.time_us + 1));
+	EXPECT_EQ(0, _buffer->count());
+
+	sample pop = {};
+	EXPECT_EQ(false, _buffer->pop_first_older_than(_z.time_us + 1, &pop));
+}
@@ -38,6 +38,7 @@
 
 #include <gtest/gtest.h>
 #include "EKF/ekf.h"
+#include "EKF/yaw_estimator/EKFGSF_yaw.h"
 #include "sensor_simulator/sensor_simulator.h"
 #include "sensor_simulator/ekf_wrapper.h"
 #include "test_helper/reset_logging_checker.h"
@@ -114,3 +115,38 @@ TEST_F(EKFYawEstimatorTest, inAirYawAlignment)
 	EXPECT_TRUE(_ekf->local_position_is_valid());
 	EXPECT_TRUE(_ekf->global_position_is_valid());
 }
+
+TEST(EKFGSFYawBankTest, turnConvergence)
+{
+	// GIVEN: the yaw estimator bank alone, driven by a level vehicle in a constant rate turn
+	const float dt = 0.005f;           // IMU rate: 200 Hz
+	const int vel_decimation = 20;     // velocity aiding rate: 10 Hz
+	const float speed = 10.f;          // (m/s)
+	const float yaw_rate = 0.2f;       // (rad/s)
+	const float yaw_init = math::radians(100.f);
+
+	// with the airspeed known, the AHRS removes the centripetal acceleration from the tilt correction
+	EKFGSF_yaw yaw_estimator;
+	yaw_estimator.setTrueAirspeed(speed);
+
+	// body frame specific force: centripetal acceleration along Y and gravity reaction
+	const Vector3f delta_vel = Vector3f(0.f, speed * yaw_rate, -CONSTANTS_ONE_G) * dt;
+	const Vector3f delta_ang = Vector3f(0.f, 0.f, yaw_rate) * dt;
+
+	const int n_updates = 6000; // 30 s
+	float yaw = yaw_init;
+
+	for (int i = 0; i < n_updates; i++) {
+		yaw = matrix::wrap_pi(yaw + yaw_rate * dt);
+		yaw_estimator.predict(delta_ang, dt, delta_vel, dt, true);
+
+		if ((i % vel_decimation) == 0) {
+			yaw_estimator.fuseVelocity(Vector2f(speed * cosf(yaw), speed * sinf(yaw)), 0.5f, true);
+		}
+	}
+
+	// THEN: the composite yaw converges to the true heading
+	EXPECT_TRUE(yaw_estimator.isActive());
+	EXPECT_NEAR(matrix::wrap_pi(yaw_estimator.getYaw() - yaw), 0.f, math::radians(5.f));
+	EXPECT_LT(yaw_estimator.getYawVar(), sq(math::radians(5.f)));
+}
@@ -57,9 +57,15 @@ GyroFFT::~GyroFFT()
 	perf_free(_cycle_perf);
 	perf_free(_cycle_interval_perf);
 	perf_free(_fft_perf);
+	perf_free(_find_peaks_perf);
 	perf_free(_gyro_generation_gap_perf);
 	perf_free(_gyro_fifo_generation_gap_perf);
 
+	for (int axis = 0; axis < 3; axis++) {
+		perf_free(_peak_tracking_perf[axis]);
+		perf_free(_peak_update_interval_perf[axis]);
+	}
+
 	delete[] _gyro_data_buffer_x;
 	delete[] _gyro_data_buffer_y;
 	delete[] _gyro_data_buffer_z;
@@ -140,6 +146,7 @@ bool GyroFFT::init()
 
 	if (buffers_allocated) {
 		_imu_gyro_fft_len = _param_imu_gyro_fft_len.get();
+		_peak_tracking = _param_imu_gyro_fft_trk.get();
 
 		// init Hanning window
 		for (int n = 0; n < _imu_gyro_fft_len; n++) {
@@ -326,9 +333,6 @@ void GyroFFT::Run()
 	const bool selection_updated = SensorSelectionUpdate();
 	VehicleIMUStatusUpdate(selection_updated);
 
-	// reset
-	_fft_updated = false;
-
 	if (_gyro_fifo) {
 		// run on sensor gyro fifo updates
 		sensor_gyro_fifo_s sensor_gyro_fifo;
@@ -336,9 +340,7 @@ void GyroFFT::Run()
 		while (_sensor_gyro_fifo_sub.update(&sensor_gyro_fifo)) {
 			if (_sensor_gyro_fifo_sub.get_last_generation() != _gyro_last_generation + 1) {
 				// force reset if we've missed a sample
-				_fft_buffer_index[0] = 0;
-				_fft_buffer_index[1] = 0;
-				_fft_buffer_index[2] = 0;
+				ResetBuffers();
 
 				perf_count(_gyro_fifo_generation_gap_perf);
 			}
@@ -347,9 +349,7 @@ void GyroFFT::Run()
 
 			if (fabsf(sensor_gyro_fifo.scale - _fifo_last_scale) > FLT_EPSILON) {
 				// force reset if scale has changed
-				_fft_buffer_index[0] = 0;
-				_fft_buffer_index[1] = 0;
-				_fft_buffer_index[2] = 0;
+				ResetBuffers();
 
 				_fifo_last_scale = sensor_gyro_fifo.scale;
 			}
@@ -365,9 +365,7 @@ void GyroFFT::Run()
 		while (_sensor_gyro_sub.update(&sensor_gyro)) {
 			if (_sensor_gyro_sub.get_last_generation() != _gyro_last_generation + 1) {
 				// force reset if we've missed a sample
-				_fft_buffer_index[0] = 0;
-				_fft_buffer_index[1] = 0;
-				_fft_buffer_index[2] = 0;
+				ResetBuffers();
 
 				perf_count(_gyro_generation_gap_perf);
 			}
@@ -384,6 +382,27 @@ void GyroFFT::Run()
 		}
 	}
 
+	// one step of the full spectrum analysis per cycle to avoid latency spikes
+	if (_fft_axis >= 0) {
+		perf_begin(_find_peaks_perf);
+		FindPeaks(_fft_timestamp_sample, _fft_axis, _fft_outupt_buffer);
+		UpdatePeakTracking(_fft_axis);
+		_fft_axis = -1;
+		perf_end(_find_peaks_perf);
+
+	} else if (_fft_pending != 0) {
+		for (int axis = 0; axis < 3; axis++) {
+			if (_fft_pending & (1 << axis)) {
+				_fft_pending &= ~(1 << axis);
+
+				ComputeFFT(axis);
+				_fft_timestamp_sample = _timestamp_sample_last;
+				_fft_axis = axis;
+				break;
+			}
+		}
+	}
+
 	if (_publish) {
 		Publish();
 		_publish = false;
@@ -392,41 +411,170 @@ void GyroFFT::Run()
 	perf_end(_cycle_perf);
 }
 
+void GyroFFT::ResetBuffers()
+{
+	_buffer_index = 0;
+	_buffer_samples = 0;
+	_samples_since_fft = 0;
+
+	_fft_pending = 0;
+	_fft_axis = -1;
+
+	for (int axis = 0; axis < 3; axis++) {
+		for (int peak = 0; peak < MAX_NUM_PEAKS; peak++) {
+			_sliding_dft[axis][peak].disable();
+		}
+	}
+}
+
 void GyroFFT::Update(const hrt_abstime &timestamp_sample, int16_t *input[], uint8_t N)
 {
 	q15_t *gyro_data_buffer[] {_gyro_data_buffer_x, _gyro_data_buffer_y, _gyro_data_buffer_z};
 
+	// sliding DFT updates need the sample leaving the window
+	const bool buffer_full = (_buffer_samples >= _imu_gyro_fft_len);
+
 	for (int axis = 0; axis < 3; axis++) {
-		int &buffer_index = _fft_buffer_index[axis];
+		SlidingDFT *sliding_dft = _sliding_dft[axis];
+		const bool tracking = _peak_tracking && buffer_full
+				      && (sliding_dft[0].enabled() || sliding_dft[1].enabled() || sliding_dft[2].enabled());
+
+		if (tracking) {
+			perf_begin(_peak_tracking_perf[axis]);
+		}
+
+		int buffer_index = _buffer_index;
 
 		for (int n = 0; n < N; n++) {
-			if (buffer_index < _imu_gyro_fft_len) {
-				// convert int16_t -> q15_t (scaling isn't relevant)
-				gyro_data_buffer[axis][buffer_index] = input[axis][n] / 2;
-				buffer_index++;
+			// convert int16_t -> q15_t (scaling isn't relevant)
+			const q15_t sample = input[axis][n] / 2;
+			const q15_t sample_old = gyro_data_buffer[axis][buffer_index];
+
+			gyro_data_buffer[axis][buffer_index] = sample;
+
+			if (++buffer_index >= _imu_gyro_fft_len) {
+				buffer_index = 0;
+			}
+
+			if (tracking) {
+				for (int peak = 0; peak < MAX_NUM_PEAKS; peak++) {
+					if (sliding_dft[peak].enabled()) {
+						sliding_dft[peak].update(sample, sample_old);
+					}
+				}
 			}
+		}
+
+		if (tracking) {
+			TrackPeaks(timestamp_sample, axis, buffer_index);
+			perf_end(_peak_tracking_perf[axis]);
+		}
+	}
+
+	_buffer_index = (_buffer_index + N) % _imu_gyro_fft_len;
+	_buffer_samples = math::min(_buffer_samples + N, _imu_gyro_fft_len);
+	_samples_since_fft += N;
+	_timestamp_sample_last = timestamp_sample;
+
+	// new full FFT of all axes every 1/4 window (3/4 overlap)
+	if ((_buffer_samples >= _imu_gyro_fft_len) && (_samples_since_fft >= _imu_gyro_fft_len / 4)) {
+		_fft_pending = (1 << 0) | (1 << 1) | (1 << 2);
+		_samples_since_fft = 0;
+	}
+}
+
+void GyroFFT::ComputeFFT(int axis)
+{
+	perf_begin(_fft_perf);
+
+	q15_t *gyro_data_buffer[] {_gyro_data_buffer_x, _gyro_data_buffer_y, _gyro_data_buffer_z};
+
+	// window the circular buffer from the oldest to the newest sample
+	const int oldest = _buffer_index;
+	const int num_samples_end = _imu_gyro_fft_len - oldest;
+
+	arm_mult_q15(&gyro_data_buffer[axis][oldest], &_hanning_window[0], &_fft_input_buffer[0], num_samples_end);
 
-			// if we have enough samples begin processing, but only one FFT per cycle
-			if ((buffer_index >= _imu_gyro_fft_len) && !_fft_updated) {
-				perf_begin(_fft_perf);
+	if (oldest > 0) {
+		arm_mult_q15(&gyro_data_buffer[axis][0], &_hanning_window[num_samples_end], &_fft_input_buffer[num_samples_end],
+			     oldest);
+	}
+
+	arm_rfft_q15(&_rfft_q15, _fft_input_buffer, _fft_outupt_buffer);
+
+	perf_end(_fft_perf);
+}
+
+void GyroFFT::UpdatePeakTracking(int axis)
+{
+	if (!_peak_tracking) {
+		return;
+	}
 
-				arm_mult_q15(gyro_data_buffer[axis], _hanning_window, _fft_input_buffer, _imu_gyro_fft_len);
-				arm_rfft_q15(&_rfft_q15, _fft_input_buffer, _fft_outupt_buffer);
+	const float *peak_frequencies_publish[] { _sensor_gyro_fft.peak_frequencies_x, _sensor_gyro_fft.peak_frequencies_y, _sensor_gyro_fft.peak_frequencies_z };
+	const float resolution_hz = _gyro_sample_rate_hz / _imu_gyro_fft_len;
 
-				_fft_updated = true;
+	q15_t *gyro_data_buffer[] {_gyro_data_buffer_x, _gyro_data_buffer_y, _gyro_data_buffer_z};
 
-				FindPeaks(timestamp_sample, axis, _fft_outupt_buffer);
+	// (re)start tracking the published peaks at their current bin
+	for (int peak = 0; peak < MAX_NUM_PEAKS; peak++) {
+		SlidingDFT &sliding_dft = _sliding_dft[axis][peak];
+		const float peak_frequency = peak_frequencies_publish[axis][peak];
 
-				// reset
-				// shift buffer (3/4 overlap)
-				const int overlap_start = _imu_gyro_fft_len / 4;
-				memmove(&gyro_data_buffer[axis][0], &gyro_data_buffer[axis][overlap_start], sizeof(q15_t) * overlap_start * 3);
-				buffer_index = overlap_start * 3;
+		if (PX4_ISFINITE(peak_frequency) && (peak_frequency > 0.f) && (_buffer_samples >= _imu_gyro_fft_len)) {
+			const int bin = lroundf(peak_frequency / resolution_hz);
 
-				perf_end(_fft_perf);
+			if (!sliding_dft.enabled() || (sliding_dft.bin() != bin)) {
+				sliding_dft.init(bin, _imu_gyro_fft_len, gyro_data_buffer[axis], _buffer_index);
 			}
+
+		} else {
+			sliding_dft.disable();
+		}
+	}
+}
+
+void GyroFFT::TrackPeaks(const hrt_abstime &timestamp_sample, int axis, int oldest)
+{
+	float *peak_frequencies_publish[] { _sensor_gyro_fft.peak_frequencies_x, _sensor_gyro_fft.peak_frequencies_y, _sensor_gyro_fft.peak_frequencies_z };
+	const float resolution_hz = _gyro_sample_rate_hz / _imu_gyro_fft_len;
+
+	q15_t *gyro_data_buffer[] {_gyro_data_buffer_x, _gyro_data_buffer_y, _gyro_data_buffer_z};
+
+	bool updated = false;
+
+	for (int peak = 0; peak < MAX_NUM_PEAKS; peak++) {
+		SlidingDFT &sliding_dft = _sliding_dft[axis][peak];
+
+		if (!sliding_dft.enabled()) {
+			continue;
+		}
+
+		const int peak_bin = sliding_dft.peakBin();
+
+		if (peak_bin != sliding_dft.bin()) {
+			// the peak moved to a neighbouring bin, follow it (estimate on the next update)
+			sliding_dft.init(peak_bin, _imu_gyro_fft_len, gyro_data_buffer[axis], oldest);
+			continue;
+		}
+
+		const float peak_frequency = resolution_hz * sliding_dft.estimateBin();
+
+		if (PX4_ISFINITE(peak_frequency)
+		    && (peak_frequency >= _param_imu_gyro_fft_min.get())
+		    && (peak_frequency <= _param_imu_gyro_fft_max.get())) {
+
+			// the peak itself is only kept alive (_last_update) by the full FFT
+			peak_frequencies_publish[axis][peak] = _median_filter[axis][peak].apply(peak_frequency);
+			_sensor_gyro_fft.timestamp_sample = timestamp_sample;
+			_publish = true;
+			updated = true;
 		}
 	}
+
+	if (updated) {
+		perf_count(_peak_update_interval_perf[axis]);
+	}
 }
 
 void GyroFFT::FindPeaks(const hrt_abstime &timestamp_sample, int axis, q15_t *fft_outupt_buffer)
@@ -579,6 +727,7 @@ void GyroFFT::UpdateOutput(const hrt_abstime &timestamp_sample, int axis, float
 	bool peak_new_copied[MAX_NUM_PEAKS] {};
 	bool peak_out_filled[MAX_NUM_PEAKS] {};
 	int peaks_copied = 0;
+	bool updated = false;
 
 	for (int new_peak = 0; new_peak < num_peaks_found; new_peak++) {
 
@@ -611,6 +760,7 @@ void GyroFFT::UpdateOutput(const hrt_abstime &timestamp_sample, int axis, float
 				_last_update[axis][closest_prev_peak] = timestamp_sample;
 				_sensor_gyro_fft.timestamp_sample = timestamp_sample;
 				_publish = true;
+				updated = true;
 
 				// clear
 				peak_frequencies[closest_new_peak] = NAN;
@@ -661,11 +811,16 @@ void GyroFFT::UpdateOutput(const hrt_abstime &timestamp_sample, int axis, float
 						_last_update[axis][oldest_slot] = timestamp_sample;
 						_sensor_gyro_fft.timestamp_sample = timestamp_sample;
 						_publish = true;
+						updated = true;
 					}
 				}
 			}
 		}
 	}
+
+	if (updated) {
+		perf_count(_peak_update_interval_perf[axis]);
+	}
 }
 
 void GyroFFT::Publish()
@@ -702,10 +857,21 @@ int GyroFFT::task_spawn(int argc, char *argv[])
 
 int GyroFFT::print_status()
 {
-	PX4_INFO("gyro sample rate: %.3f Hz", (double)_gyro_sample_rate_hz);
+	PX4_INFO("gyro sample rate: %.3f Hz, FFT length: %" PRId32 ", peak tracking: %s", (double)_gyro_sample_rate_hz,
+		 _imu_gyro_fft_len, _peak_tracking ? "sliding DFT" : "off");
 	perf_print_counter(_cycle_perf);
 	perf_print_counter(_cycle_interval_perf);
 	perf_print_counter(_fft_perf);
+	perf_print_counter(_find_peaks_perf);
+
+	for (int axis = 0; axis < 3; axis++) {
+		if (_peak_tracking) {
+			perf_print_counter(_peak_tracking_perf[axis]);
+		}
+
+		perf_print_counter(_peak_update_interval_perf[axis]);
+	}
+
 	perf_print_counter(_gyro_generation_gap_perf);
 	perf_print_counter(_gyro_fifo_generation_gap_perf);
 	return 0;
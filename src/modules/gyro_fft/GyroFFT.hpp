@@ -56,6 +56,8 @@
 #include "arm_math.h"
 #include "arm_const_structs.h"
 
+#include "SlidingDFT.hpp"
+
 using namespace time_literals;
 
 class GyroFFT : public ModuleBase<GyroFFT>, public ModuleParams, public px4::ScheduledWorkItem
@@ -85,11 +87,15 @@ private:
 			sensor_gyro_fft_s::peak_frequencies_x[0]);
 
 	void Run() override;
+	void ComputeFFT(int axis);
 	inline void FindPeaks(const hrt_abstime &timestamp_sample, int axis, q15_t *fft_outupt_buffer);
 	inline float EstimatePeakFrequencyBin(q15_t fft[], int peak_index);
 	inline void Publish();
+	void ResetBuffers();
 	bool SensorSelectionUpdate(bool force = false);
+	void TrackPeaks(const hrt_abstime &timestamp_sample, int axis, int oldest);
 	void Update(const hrt_abstime &timestamp_sample, int16_t *input[], uint8_t N);
+	void UpdatePeakTracking(int axis);
 	inline void UpdateOutput(const hrt_abstime &timestamp_sample, int axis, float peak_frequencies[MAX_NUM_PEAKS],
 				 float peak_snr[MAX_NUM_PEAKS], int num_peaks_found);
 	void VehicleIMUStatusUpdate(bool force = false);
@@ -125,6 +131,7 @@ private:
 	perf_counter_t _cycle_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": cycle")};
 	perf_counter_t _cycle_interval_perf{perf_alloc(PC_INTERVAL, MODULE_NAME": cycle interval")};
 	perf_counter_t _fft_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": FFT")};
+	perf_counter_t _find_peaks_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": find peaks")};
 	perf_counter_t _gyro_generation_gap_perf{nullptr};
 	perf_counter_t _gyro_fifo_generation_gap_perf{nullptr};
 
@@ -147,7 +154,32 @@ private:
 
 	float _fifo_last_scale{0};
 
-	int _fft_buffer_index[3] {};
+	// circular sample buffers, the oldest sample is at _buffer_index once full
+	int _buffer_index{0};
+	int _buffer_samples{0};
+	int _samples_since_fft{0};
+
+	// the full FFT is spread over consecutive cycles: transform of one axis, then its peak search
+	uint8_t _fft_pending{0}; // axes (bitmask) due for a full FFT
+	int _fft_axis{-1};       // axis with a transform waiting for the peak search
+	hrt_abstime _fft_timestamp_sample{0};
+	hrt_abstime _timestamp_sample_last{0};
+
+	// sliding DFT tracking of the published peaks in between full FFTs (IMU_GYRO_FFT_TRK)
+	SlidingDFT _sliding_dft[3][MAX_NUM_PEAKS] {};
+	bool _peak_tracking{false};
+
+	perf_counter_t _peak_tracking_perf[3] {
+		perf_alloc(PC_ELAPSED, MODULE_NAME": peak tracking x"),
+		perf_alloc(PC_ELAPSED, MODULE_NAME": peak tracking y"),
+		perf_alloc(PC_ELAPSED, MODULE_NAME": peak tracking z"),
+	};
+
+	perf_counter_t _peak_update_interval_perf[3] {
+		perf_alloc(PC_INTERVAL, MODULE_NAME": peak update interval x"),
+		perf_alloc(PC_INTERVAL, MODULE_NAME": peak update interval y"),
+		perf_alloc(PC_INTERVAL, MODULE_NAME": peak update interval z"),
+	};
 
 	unsigned _gyro_last_generation{0};
 
@@ -159,14 +191,14 @@ private:
 
 	int32_t _imu_gyro_fft_len{256};
 
-	bool _fft_updated{false};
 	bool _publish{false};
 
 	DEFINE_PARAMETERS(
 		(ParamInt<px4::params::IMU_GYRO_FFT_LEN>) _param_imu_gyro_fft_len,
 		(ParamFloat<px4::params::IMU_GYRO_FFT_MIN>) _param_imu_gyro_fft_min,
 		(ParamFloat<px4::params::IMU_GYRO_FFT_MAX>) _param_imu_gyro_fft_max,
-		(ParamFloat<px4::params::IMU_GYRO_FFT_SNR>) _param_imu_gyro_fft_snr
+		(ParamFloat<px4::params::IMU_GYRO_FFT_SNR>) _param_imu_gyro_fft_snr,
+		(ParamBool<px4::params::IMU_GYRO_FFT_TRK>) _param_imu_gyro_fft_trk
 	)
 };
 
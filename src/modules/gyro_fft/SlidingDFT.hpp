@@ -0,0 +1,183 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#pragma once
+
+#include <mathlib/math/Functions.hpp>
+#include <float.h>
+#include <stdint.h>
+
+/**
+ * Sliding DFT of a tracked spectral peak bin and its two neighbours.
+ *
+ * Every new sample updates the three bins of the last N samples in constant time
+ * (S(n) = r W S(n-1) + x(n) - r^N x(n-N)), so the peak frequency can be re-estimated after
+ * each batch of samples instead of waiting for the next full FFT. The slight damping r keeps
+ * the recursion numerically stable in single precision.
+ *
+ * The bins are those of a rectangular window, the fractional bin is estimated with Jacobsen's estimator.
+ */
+class SlidingDFT
+{
+public:
+	static constexpr int NUM_BINS = 3; // tracked bin and its neighbours
+
+	bool enabled() const { return _bin > 0; }
+	int bin() const { return _bin; }
+
+	void disable() { _bin = 0; }
+
+	/**
+	 * Start tracking a bin, initializing the DFT from the last N samples
+	 * @param bin tracked bin (1 .. N/2 - 2)
+	 * @param buffer circular sample buffer of length N
+	 * @param oldest index of the oldest sample in buffer
+	 */
+	template<typename T>
+	void init(int bin, int N, const T buffer[], int oldest)
+	{
+		if ((bin < 1) || (bin + 1 >= N / 2)) {
+			disable();
+			return;
+		}
+
+		_bin = bin;
+		_damping_n = powf(DAMPING, N);
+
+		for (int i = 0; i < NUM_BINS; i++) {
+			const float angle = 2.f * M_PI_F * (bin - 1 + i) / N;
+
+			_phase_re[i] = cosf(angle);
+			_phase_im[i] = sinf(angle);
+
+			_w_re[i] = DAMPING * _phase_re[i];
+			_w_im[i] = DAMPING * _phase_im[i];
+
+			_re[i] = 0.f;
+			_im[i] = 0.f;
+		}
+
+		// bins of the current window, from oldest to newest sample
+		for (int n = 0; n < N; n++) {
+			const int index = (oldest + n) % N;
+			update(buffer[index], 0.f);
+		}
+	}
+
+	/**
+	 * Slide the window by one sample
+	 * @param sample newest sample
+	 * @param sample_old sample N samples ago, leaving the window
+	 */
+	inline void update(float sample, float sample_old)
+	{
+		const float input = sample - _damping_n * sample_old;
+
+		for (int i = 0; i < NUM_BINS; i++) {
+			const float re = _w_re[i] * _re[i] - _w_im[i] * _im[i] + input;
+			const float im = _w_re[i] * _im[i] + _w_im[i] * _re[i];
+			_re[i] = re;
+			_im[i] = im;
+		}
+	}
+
+	/**
+	 * @return bin with the largest magnitude: the tracked bin or one of its neighbours if the peak moved
+	 */
+	int peakBin() const
+	{
+		int peak = 0;
+		float peak_magnitude_squared = 0.f;
+
+		for (int i = 0; i < NUM_BINS; i++) {
+			const float magnitude_squared = _re[i] * _re[i] + _im[i] * _im[i];
+
+			if (magnitude_squared > peak_magnitude_squared) {
+				peak_magnitude_squared = magnitude_squared;
+				peak = i;
+			}
+		}
+
+		return _bin - 1 + peak;
+	}
+
+	/**
+	 * Fractional peak bin, Jacobsen's estimator: d = Re[(X[k-1] - X[k+1]) / (2 X[k] - X[k-1] - X[k+1])]
+	 * @return estimated bin or NAN
+	 */
+	float estimateBin() const
+	{
+		// S(n) = exp(-j 2 pi k / N) X[k], rotate back to the DFT phase
+		float x_re[NUM_BINS];
+		float x_im[NUM_BINS];
+
+		for (int i = 0; i < NUM_BINS; i++) {
+			x_re[i] = _re[i] * _phase_re[i] - _im[i] * _phase_im[i];
+			x_im[i] = _re[i] * _phase_im[i] + _im[i] * _phase_re[i];
+		}
+
+		const float num_re = x_re[0] - x_re[2];
+		const float num_im = x_im[0] - x_im[2];
+		const float den_re = 2.f * x_re[1] - x_re[0] - x_re[2];
+		const float den_im = 2.f * x_im[1] - x_im[0] - x_im[2];
+
+		const float den = den_re * den_re + den_im * den_im;
+
+		if (den > FLT_EPSILON) {
+			const float d = (num_re * den_re + num_im * den_im) / den;
+
+			if (fabsf(d) <= 0.5f) {
+				return _bin + d;
+			}
+		}
+
+		return NAN;
+	}
+
+private:
+	static constexpr float DAMPING = 0.99995f;
+
+	float _re[NUM_BINS] {};
+	float _im[NUM_BINS] {};
+
+	// damped twiddle factors r exp(j 2 pi k / N) and DFT phase exp(j 2 pi k / N)
+	float _w_re[NUM_BINS] {};
+	float _w_im[NUM_BINS] {};
+	float _phase_re[NUM_BINS] {};
+	float _phase_im[NUM_BINS] {};
+
+	float _damping_n{1.f}; // r^N
+
+	int _bin{0};
+};
@@ -83,3 +83,16 @@ PARAM_DEFINE_INT32(IMU_GYRO_FFT_LEN, 512);
 * @group Sensors
 */
 PARAM_DEFINE_FLOAT(IMU_GYRO_FFT_SNR, 10.f);
+
+/**
+* IMU gyro FFT peak tracking.
+*
+* Track the detected peaks with a sliding DFT in between full FFTs, updating
+* the peak frequencies after every batch of gyro samples instead of once per
+* FFT window hop.
+*
+* @boolean
+* @reboot_required true
+* @group Sensors
+*/
+PARAM_DEFINE_INT32(IMU_GYRO_FFT_TRK, 0);
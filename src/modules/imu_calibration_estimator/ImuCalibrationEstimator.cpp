@@ -0,0 +1,361 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include "ImuCalibrationEstimator.hpp"
+
+using namespace time_literals;
+using matrix::Vector3f;
+
+namespace imu_calibration_estimator
+{
+
+ImuCalibrationEstimator::ImuCalibrationEstimator() :
+	ScheduledWorkItem(MODULE_NAME, px4::wq_configurations::lp_default)
+{
+	_imu_calibration_estimate_pub.advertise();
+}
+
+ImuCalibrationEstimator::~ImuCalibrationEstimator()
+{
+	perf_free(_cycle_perf);
+	perf_free(_segment_perf);
+}
+
+int ImuCalibrationEstimator::task_spawn(int argc, char *argv[])
+{
+	ImuCalibrationEstimator *obj = new ImuCalibrationEstimator();
+
+	if (!obj) {
+		PX4_ERR("alloc failed");
+		return -1;
+	}
+
+	_object.store(obj);
+	_task_id = task_id_is_work_queue;
+
+	/* Schedule a cycle to start things. */
+	obj->start();
+
+	return 0;
+}
+
+void ImuCalibrationEstimator::start()
+{
+	// while disarmed every vehicle_imu publication runs the estimator (see Run()),
+	// the slow interval picks up new IMUs and arming state changes
+	ScheduleOnInterval(1_s);
+}
+
+void ImuCalibrationEstimator::Reset(int imu_index)
+{
+	_accel_estimator[imu_index].reset();
+	_accel_direction_last[imu_index].zero();
+	_accel_segments[imu_index] = 0;
+
+	_gyro_offset[imu_index].zero();
+	_gyro_segments[imu_index] = 0;
+
+	ResetSegment(imu_index);
+}
+
+void ImuCalibrationEstimator::ResetSegment(int imu_index)
+{
+	_segment[imu_index] = Segment{};
+}
+
+void ImuCalibrationEstimator::UnregisterCallbacks()
+{
+	for (auto &sub : _vehicle_imu_subs) {
+		sub.unregisterCallback();
+	}
+}
+
+void ImuCalibrationEstimator::Run()
+{
+	if (should_exit()) {
+		UnregisterCallbacks();
+		ScheduleClear();
+		exit_and_cleanup();
+		return;
+	}
+
+	if (_vehicle_status_sub.updated()) {
+		vehicle_status_s vehicle_status;
+
+		if (_vehicle_status_sub.copy(&vehicle_status)) {
+			if (_arming_state != vehicle_status.arming_state) {
+				_arming_state = vehicle_status.arming_state;
+
+				for (int imu_index = 0; imu_index < MAX_SENSOR_COUNT; imu_index++) {
+					ResetSegment(imu_index);
+				}
+			}
+
+			_system_calibrating = vehicle_status.calibration_enabled;
+		}
+	}
+
+	// only run when disarmed, never compete with flight critical work
+	if (_arming_state == vehicle_status_s::ARMING_STATE_ARMED) {
+		UnregisterCallbacks();
+		return;
+	}
+
+	// process every vehicle_imu sample (no queue), register once the instance exists
+	for (auto &sub : _vehicle_imu_subs) {
+		if (!sub.registered() && sub.advertised()) {
+			sub.registerCallback();
+		}
+	}
+
+	// check for parameter updates
+	if (_parameter_update_sub.updated()) {
+		// clear update
+		parameter_update_s pupdate;
+		_parameter_update_sub.copy(&pupdate);
+
+		for (int imu_index = 0; imu_index < MAX_SENSOR_COUNT; imu_index++) {
+			_accel_calibration[imu_index].ParametersUpdate();
+			_gyro_calibration[imu_index].ParametersUpdate();
+		}
+	}
+
+	// do nothing during regular sensor calibration
+	if (_system_calibrating) {
+		return;
+	}
+
+	perf_begin(_cycle_perf);
+
+	bool updated = false;
+
+	for (int imu_index = 0; imu_index < MAX_SENSOR_COUNT; imu_index++) {
+		vehicle_imu_s imu;
+
+		if (_vehicle_imu_subs[imu_index].update(&imu)) {
+
+			if ((imu.accel_device_id != _accel_calibration[imu_index].device_id())
+			    || (imu.gyro_device_id != _gyro_calibration[imu_index].device_id())
+			    || (imu.accel_calibration_count != _accel_calibration_count[imu_index])
+			    || (imu.gyro_calibration_count != _gyro_calibration_count[imu_index])) {
+
+				// the estimates are relative to the calibration in use
+				_accel_calibration[imu_index].set_device_id(imu.accel_device_id);
+				_gyro_calibration[imu_index].set_device_id(imu.gyro_device_id);
+				_accel_calibration_count[imu_index] = imu.accel_calibration_count;
+				_gyro_calibration_count[imu_index] = imu.gyro_calibration_count;
+
+				Reset(imu_index);
+			}
+
+			if (UpdateSegment(imu_index, imu)) {
+				updated = true;
+			}
+		}
+	}
+
+	if (updated) {
+		publishImuCalibrationEstimate();
+	}
+
+	perf_end(_cycle_perf);
+}
+
+bool ImuCalibrationEstimator::UpdateSegment(int imu_index, const vehicle_imu_s &imu)
+{
+	Segment &segment = _segment[imu_index];
+
+	if ((imu.delta_velocity_dt == 0) || (imu.delta_angle_dt == 0)
+	    || (imu.delta_velocity_clipping != 0) || (imu.delta_angle_clipping != 0)) {
+		ResetSegment(imu_index);
+		return false;
+	}
+
+	// vehicle_imu is calibrated and rotated to the board frame, rotate back to the calibrated sensor frame
+	const Vector3f accel = _accel_calibration[imu_index].rotation().transpose()
+			       * Vector3f{imu.delta_velocity} * (1e6f / imu.delta_velocity_dt);
+	const Vector3f gyro = _gyro_calibration[imu_index].rotation().transpose()
+			      * Vector3f{imu.delta_angle} * (1e6f / imu.delta_angle_dt);
+
+	if (segment.count == 0) {
+		segment.timestamp_start = imu.timestamp_sample;
+	}
+
+	segment.accel_sum += accel;
+	segment.accel_sum_sq += accel.emult(accel);
+	segment.gyro_sum += gyro;
+	segment.gyro_sum_sq += gyro.emult(gyro);
+	segment.count++;
+
+	if (imu.timestamp_sample < segment.timestamp_start + SEGMENT_DURATION) {
+		return false;
+	}
+
+	// segment complete, check if the vehicle was stationary
+	const float count_inv = 1.f / segment.count;
+	const Vector3f accel_mean = segment.accel_sum * count_inv;
+	const Vector3f accel_var = segment.accel_sum_sq * count_inv - accel_mean.emult(accel_mean);
+	const Vector3f gyro_mean = segment.gyro_sum * count_inv;
+	const Vector3f gyro_var = segment.gyro_sum_sq * count_inv - gyro_mean.emult(gyro_mean);
+
+	ResetSegment(imu_index);
+
+	if ((accel_var.max() > SEGMENT_ACCEL_VAR_MAX)
+	    || (gyro_var.max() > SEGMENT_GYRO_VAR_MAX)
+	    || gyro_mean.longerThan(SEGMENT_GYRO_MEAN_MAX)
+	    || !accel_mean.isAllFinite() || !gyro_mean.isAllFinite()) {
+		return false;
+	}
+
+	perf_count(_segment_perf);
+
+	// gyro offset: average of the stationary segments, limited to the most recent ones
+	if (_gyro_segments[imu_index] < UINT8_MAX) {
+		_gyro_segments[imu_index]++;
+	}
+
+	const int gyro_average_count = math::min((int)_gyro_segments[imu_index], GYRO_SEGMENTS_AVERAGE_MAX);
+	_gyro_offset[imu_index] += (gyro_mean - _gyro_offset[imu_index]) / gyro_average_count;
+
+	// accel offset & scale: only use new orientations, repeated segments in the same orientation add no information
+	const Vector3f accel_direction = accel_mean.normalized();
+
+	if (accel_direction.dot(_accel_direction_last[imu_index]) < ACCEL_ORIENTATION_CHANGE_MIN) {
+		if (_accel_estimator[imu_index].update(accel_mean)) {
+			_accel_direction_last[imu_index] = accel_direction;
+
+			if (_accel_segments[imu_index] < UINT8_MAX) {
+				_accel_segments[imu_index]++;
+			}
+		}
+	}
+
+	return true;
+}
+
+void ImuCalibrationEstimator::publishImuCalibrationEstimate()
+{
+	imu_calibration_estimate_s estimate{};
+
+	for (int imu_index = 0; imu_index < MAX_SENSOR_COUNT; imu_index++) {
+		const calibration::Accelerometer &accel_calibration = _accel_calibration[imu_index];
+		const calibration::Gyroscope &gyro_calibration = _gyro_calibration[imu_index];
+
+		// f = scale_est .* (scale .* (raw - offset) - offset_est) = (scale_est .* scale) .* (raw - (offset + offset_est ./ scale))
+		const Vector3f accel_offset = accel_calibration.offset()
+					      + _accel_estimator[imu_index].getOffset().edivide(accel_calibration.scale());
+		const Vector3f accel_scale = accel_calibration.scale().emult(_accel_estimator[imu_index].getScale());
+
+		estimate.accel_device_id[imu_index] = accel_calibration.device_id();
+		estimate.accel_offset_x[imu_index] = accel_offset(0);
+		estimate.accel_offset_y[imu_index] = accel_offset(1);
+		estimate.accel_offset_z[imu_index] = accel_offset(2);
+		estimate.accel_scale_x[imu_index] = accel_scale(0);
+		estimate.accel_scale_y[imu_index] = accel_scale(1);
+		estimate.accel_scale_z[imu_index] = accel_scale(2);
+		estimate.accel_segments[imu_index] = _accel_segments[imu_index];
+		estimate.accel_valid[imu_index] = _accel_estimator[imu_index].converged();
+
+		const Vector3f gyro_offset = gyro_calibration.offset() + _gyro_offset[imu_index];
+
+		estimate.gyro_device_id[imu_index] = gyro_calibration.device_id();
+		estimate.gyro_offset_x[imu_index] = gyro_offset(0);
+		estimate.gyro_offset_y[imu_index] = gyro_offset(1);
+		estimate.gyro_offset_z[imu_index] = gyro_offset(2);
+		estimate.gyro_segments[imu_index] = _gyro_segments[imu_index];
+		estimate.gyro_valid[imu_index] = (_gyro_segments[imu_index] >= GYRO_SEGMENTS_VALID);
+	}
+
+	estimate.timestamp = hrt_absolute_time();
+	_imu_calibration_estimate_pub.publish(estimate);
+}
+
+int ImuCalibrationEstimator::print_status()
+{
+	for (int imu_index = 0; imu_index < MAX_SENSOR_COUNT; imu_index++) {
+		if (_accel_calibration[imu_index].device_id() != 0) {
+			const Vector3f offset = _accel_estimator[imu_index].getOffset();
+			const Vector3f scale = _accel_estimator[imu_index].getScale();
+
+			PX4_INFO("accel %d (%" PRIu32 ") segments: %d %s, offset: [% 05.3f % 05.3f % 05.3f] scale: [%.4f %.4f %.4f]",
+				 imu_index, _accel_calibration[imu_index].device_id(), _accel_segments[imu_index],
+				 _accel_estimator[imu_index].converged() ? "(converged)" : "",
+				 (double)offset(0), (double)offset(1), (double)offset(2),
+				 (double)scale(0), (double)scale(1), (double)scale(2));
+		}
+
+		if (_gyro_calibration[imu_index].device_id() != 0) {
+			const Vector3f &offset = _gyro_offset[imu_index];
+
+			PX4_INFO("gyro %d (%" PRIu32 ") segments: %d, offset: [% 05.4f % 05.4f % 05.4f]",
+				 imu_index, _gyro_calibration[imu_index].device_id(), _gyro_segments[imu_index],
+				 (double)offset(0), (double)offset(1), (double)offset(2));
+		}
+	}
+
+	perf_print_counter(_cycle_perf);
+	perf_print_counter(_segment_perf);
+
+	return 0;
+}
+
+int ImuCalibrationEstimator::print_usage(const char *reason)
+{
+	if (reason) {
+		PX4_ERR("%s\n", reason);
+	}
+
+	PRINT_MODULE_DESCRIPTION(
+		R"DESCR_STR(
+### Description
+Online accelerometer and gyroscope calibration estimator.
+
+While disarmed, the vehicle_imu data of every IMU is split into 1 second segments and the stationary ones are used
+to estimate the residual gyroscope offsets (segment mean) and accelerometer offsets and scale factors (recursive least
+squares on the gravity magnitude, updated once per new orientation). The proposed calibration parameters are published
+as imu_calibration_estimate, the calibration in use is not changed.
+)DESCR_STR");
+
+	PRINT_MODULE_USAGE_NAME("imu_calibration_estimator", "system");
+	PRINT_MODULE_USAGE_COMMAND_DESCR("start", "Start the background task");
+	PRINT_MODULE_USAGE_DEFAULT_COMMANDS();
+	return 0;
+}
+
+extern "C" __EXPORT int imu_calibration_estimator_main(int argc, char *argv[])
+{
+	return ImuCalibrationEstimator::main(argc, argv);
+}
+
+} // namespace imu_calibration_estimator
@@ -0,0 +1,151 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file ImuCalibrationEstimator.hpp
+ *
+ * Online accelerometer and gyroscope calibration estimator. Detects stationary segments in vehicle_imu
+ * while disarmed and proposes updated calibration parameters, without changing them.
+ */
+
+#pragma once
+
+#include <drivers/drv_hrt.h>
+#include <lib/accel_calibration_estimator/AccelCalibrationEstimator.hpp>
+#include <lib/mathlib/mathlib.h>
+#include <lib/perf/perf_counter.h>
+#include <lib/sensor_calibration/Accelerometer.hpp>
+#include <lib/sensor_calibration/Gyroscope.hpp>
+#include <px4_platform_common/px4_config.h>
+#include <px4_platform_common/defines.h>
+#include <px4_platform_common/module.h>
+#include <px4_platform_common/px4_work_queue/ScheduledWorkItem.hpp>
+#include <uORB/Publication.hpp>
+#include <uORB/Subscription.hpp>
+#include <uORB/SubscriptionCallback.hpp>
+#include <uORB/topics/imu_calibration_estimate.h>
+#include <uORB/topics/parameter_update.h>
+#include <uORB/topics/vehicle_imu.h>
+#include <uORB/topics/vehicle_status.h>
+
+namespace imu_calibration_estimator
+{
+
+class ImuCalibrationEstimator : public ModuleBase<ImuCalibrationEstimator>, public px4::ScheduledWorkItem
+{
+public:
+	ImuCalibrationEstimator();
+	~ImuCalibrationEstimator() override;
+
+	static int task_spawn(int argc, char *argv[]);
+
+	/** @see ModuleBase */
+	static int custom_command(int argc, char *argv[])
+	{
+		return print_usage("unknown command");
+	}
+
+	/** @see ModuleBase */
+	static int print_usage(const char *reason = nullptr);
+
+	/** @see ModuleBase::print_status() */
+	int print_status() override;
+
+	void start();
+
+private:
+	void Run() override;
+
+	void Reset(int imu_index);
+	void ResetSegment(int imu_index);
+	void UnregisterCallbacks();
+	bool UpdateSegment(int imu_index, const vehicle_imu_s &imu);
+
+	void publishImuCalibrationEstimate();
+
+	static constexpr int MAX_SENSOR_COUNT = 4;
+
+	static constexpr hrt_abstime SEGMENT_DURATION{1000000}; // 1 s stationary segments
+	static constexpr float SEGMENT_ACCEL_VAR_MAX{0.15f * 0.15f}; // (m/s^2)^2
+	static constexpr float SEGMENT_GYRO_VAR_MAX{0.01f * 0.01f}; // (rad/s)^2
+	static constexpr float SEGMENT_GYRO_MEAN_MAX{0.05f}; // rad/s
+	static constexpr float ACCEL_ORIENTATION_CHANGE_MIN{0.94f}; // cos(20 deg)
+	static constexpr int GYRO_SEGMENTS_VALID{10};
+	static constexpr int GYRO_SEGMENTS_AVERAGE_MAX{60};
+
+	// running sums of a stationary segment candidate, in the sensor frame
+	struct Segment {
+		hrt_abstime timestamp_start{0};
+		matrix::Vector3f accel_sum{};
+		matrix::Vector3f accel_sum_sq{};
+		matrix::Vector3f gyro_sum{};
+		matrix::Vector3f gyro_sum_sq{};
+		int count{0};
+	};
+
+	Segment _segment[MAX_SENSOR_COUNT] {};
+
+	AccelCalibrationEstimator _accel_estimator[MAX_SENSOR_COUNT] {};
+	matrix::Vector3f _accel_direction_last[MAX_SENSOR_COUNT] {};
+	uint8_t _accel_segments[MAX_SENSOR_COUNT] {};
+
+	matrix::Vector3f _gyro_offset[MAX_SENSOR_COUNT] {};
+	uint8_t _gyro_segments[MAX_SENSOR_COUNT] {};
+
+	uint8_t _accel_calibration_count[MAX_SENSOR_COUNT] {};
+	uint8_t _gyro_calibration_count[MAX_SENSOR_COUNT] {};
+
+	uORB::SubscriptionCallbackWorkItem _vehicle_imu_subs[MAX_SENSOR_COUNT] {
+		{this, ORB_ID(vehicle_imu), 0},
+		{this, ORB_ID(vehicle_imu), 1},
+		{this, ORB_ID(vehicle_imu), 2},
+		{this, ORB_ID(vehicle_imu), 3}
+	};
+
+	uORB::Subscription _parameter_update_sub{ORB_ID(parameter_update)};
+	uORB::Subscription _vehicle_status_sub{ORB_ID(vehicle_status)};
+
+	uORB::Publication<imu_calibration_estimate_s> _imu_calibration_estimate_pub{ORB_ID(imu_calibration_estimate)};
+
+	calibration::Accelerometer _accel_calibration[MAX_SENSOR_COUNT];
+	calibration::Gyroscope _gyro_calibration[MAX_SENSOR_COUNT];
+
+	uint8_t _arming_state{0};
+	bool _system_calibrating{false};
+
+	perf_counter_t _cycle_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": cycle")};
+	perf_counter_t _segment_perf{perf_alloc(PC_COUNT, MODULE_NAME": stationary segment")};
+};
+
+} // namespace imu_calibration_estimator
@@ -180,6 +180,20 @@ int LogWriter::write_message(LogType type, void *ptr, size_t size, uint64_t drop
 	return ret_mavlink;
 }
 
+uint8_t *LogWriter::reserve_message(LogType type, size_t size)
+{
+	if (!_log_writer_file_for_write) {
+		return nullptr;
+	}
+
+	if (_log_writer_mavlink_for_write && type == LogType::Full && _log_writer_mavlink_for_write->is_started()) {
+		// the message needs to be written to both backends
+		return nullptr;
+	}
+
+	return _log_writer_file_for_write->reserve_message(type, size);
+}
+
 void LogWriter::select_write_backend(Backend sel_backend)
 {
 	if (sel_backend & BackendFile) {
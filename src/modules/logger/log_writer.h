@@ -94,6 +94,25 @@ public:
 	 */
 	int write_message(LogType type, void *ptr, size_t size, uint64_t dropout_start = 0);
 
+	/**
+	 * Reserve space in the file write buffer, so that a message can be serialized into it directly,
+	 * instead of being copied in with write_message(). The caller must call lock() before calling this,
+	 * and either call commit_message() or discard the reservation before unlocking.
+	 * @param size number of bytes to reserve (can be larger than the message that is committed)
+	 * @return pointer to size bytes of contiguous memory, or nullptr if the message has to be written
+	 *         with write_message() (mavlink backend active, reliable transfer required,
+	 *         or not enough contiguous space left)
+	 */
+	uint8_t *reserve_message(LogType type, size_t size);
+
+	/**
+	 * Commit a message of size bytes written to the memory returned by reserve_message()
+	 */
+	void commit_message(LogType type, size_t size)
+	{
+		if (_log_writer_file_for_write) { _log_writer_file_for_write->commit_message(type, size); }
+	}
+
 	/**
 	 * Select a backend, so that future calls to write_message() only write to the selected
 	 * sel_backend, until unselect_write_backend() is called.
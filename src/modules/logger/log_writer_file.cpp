@@ -547,6 +547,15 @@ int LogWriterFile::write_message(LogType type, void *ptr, size_t size, uint64_t
 	return write(type, ptr, size, dropout_start);
 }
 
+uint8_t *LogWriterFile::reserve_message(LogType type, size_t size)
+{
+	if (!is_started(type) || _need_reliable_transfer) {
+		return nullptr;
+	}
+
+	return _buffers[(int)type].reserve(size);
+}
+
 int LogWriterFile::write(LogType type, void *ptr, size_t size, uint64_t dropout_start)
 {
 	if (!is_started(type)) {
@@ -88,6 +88,12 @@ public:
 	/** @see LogWriter::write_message() */
 	int write_message(LogType type, void *ptr, size_t size, uint64_t dropout_start = 0);
 
+	/** @see LogWriter::reserve_message() */
+	uint8_t *reserve_message(LogType type, size_t size);
+
+	/** @see LogWriter::commit_message() */
+	void commit_message(LogType type, size_t size) { _buffers[(int)type].commit(size); }
+
 	void lock()
 	{
 		pthread_mutex_lock(&_mtx);
@@ -186,6 +192,28 @@ private:
 		 */
 		inline void write_no_check(void *ptr, size_t size);
 
+		/**
+		 * Get a pointer to size bytes of contiguous free space at the write position,
+		 * or nullptr if there is not enough space without wrapping around.
+		 */
+		uint8_t *reserve(size_t size)
+		{
+			if (_buffer_size - _head < size || available() < size) {
+				return nullptr;
+			}
+
+			return &_buffer[_head];
+		}
+
+		/**
+		 * Mark size bytes written at the position returned by reserve()
+		 */
+		void commit(size_t size)
+		{
+			_head = (_head + size) % _buffer_size;
+			_count += size;
+		}
+
 		size_t available() const { return _buffer_size - _count; }
 
 		int fd() const { return _fd; }
@@ -43,6 +43,54 @@
 
 using namespace px4::logger;
 
+TopicPriority LoggedTopics::topic_priority(const char *name)
+{
+	// topics that are never rate-reduced under write buffer back-pressure (exact names, the estimator
+	// diagnostics such as innovations and aid sources are low priority)
+	static constexpr const char *high_priority_topics[] = {
+		"actuator_motors",
+		"actuator_outputs",
+		"actuator_servos",
+		"ekf2_timestamps",
+		"estimator_event_flags",
+		"estimator_selector_status",
+		"estimator_sensor_bias",
+		"estimator_status",
+		"estimator_status_flags",
+		"failsafe_flags",
+		"rate_ctrl_status",
+		"sensor_combined",
+		"sensor_selection",
+		"trajectory_setpoint",
+		"vehicle_acceleration",
+		"vehicle_air_data",
+		"vehicle_angular_velocity",
+		"vehicle_attitude",
+		"vehicle_control_mode",
+		"vehicle_global_position",
+		"vehicle_gps_position",
+		"vehicle_imu",
+		"vehicle_land_detected",
+		"vehicle_local_position",
+		"vehicle_magnetometer",
+		"vehicle_odometry",
+		"vehicle_rates_setpoint",
+		"vehicle_status",
+		"vehicle_thrust_setpoint",
+		"vehicle_torque_setpoint",
+		"vehicle_visual_odometry",
+		"yaw_estimator_status",
+	};
+
+	for (const char *high_priority_topic : high_priority_topics) {
+		if (strcmp(name, high_priority_topic) == 0) {
+			return TopicPriority::High;
+		}
+	}
+
+	return TopicPriority::Low;
+}
+
 void LoggedTopics::add_default_topics()
 {
 	add_topic("action_request");
@@ -78,6 +126,7 @@ void LoggedTopics::add_default_topics()
 	add_optional_topic("heater_status");
 	add_topic("home_position");
 	add_topic("hover_thrust_estimate", 100);
+	add_optional_topic("imu_calibration_estimate", 1000);
 	add_topic("input_rc", 500);
 	add_optional_topic("internal_combustion_engine_status", 10);
 	add_optional_topic("iridiumsbd_status", 1000);
@@ -87,6 +136,7 @@ void LoggedTopics::add_default_topics()
 	add_optional_topic("landing_target_pose", 1000);
 	add_optional_topic("launch_detection_status", 200);
 	add_optional_topic("magnetometer_bias_estimate", 200);
+	add_optional_topic("magnetometer_interference_estimate", 200);
 	add_topic("manual_control_setpoint", 200);
 	add_topic("manual_control_switches");
 	add_topic("mission_result");
@@ -169,8 +219,11 @@ void LoggedTopics::add_default_topics()
 	add_optional_topic_multi("estimator_event_flags", 10);
 	add_optional_topic_multi("estimator_optical_flow_vel", 200);
 	add_optional_topic_multi("estimator_sensor_bias", 1000);
+	add_optional_topic_multi("estimator_smoothed_trajectory");
 	add_optional_topic_multi("estimator_status", 200);
 	add_optional_topic_multi("estimator_status_flags", 10);
+	add_optional_topic_multi("estimator_health", 200);
+	add_optional_topic_multi("estimator_update_rate");
 	add_optional_topic_multi("yaw_estimator_status", 1000);
 
 	// log all raw sensors at minimal rate (at least 1 Hz)
@@ -442,6 +495,7 @@ bool LoggedTopics::add_topic(const orb_metadata *topic, uint16_t interval_ms, ui
 	RequestedSubscription &sub = _subscriptions.sub[_subscriptions.count++];
 	sub.interval_ms = interval_ms;
 	sub.instance = instance;
+	sub.priority = topic_priority(topic->o_name);
 	sub.id = static_cast<ORB_ID>(topic->o_id);
 	return true;
 }
@@ -63,6 +63,15 @@ enum class MissionLogType : int32_t {
 	Geotagging =             2
 };
 
+/**
+ * Priority of a logged topic, used to decide which topics can be rate-limited
+ * when the write buffer fills up (see Logger::update_backpressure_throttling())
+ */
+enum class TopicPriority : uint8_t {
+	Low = 0,  ///< may be logged at a reduced rate under write buffer back-pressure
+	High      ///< estimator & control topics, always logged at the configured rate
+};
+
 inline bool operator&(SDLogProfileMask a, SDLogProfileMask b)
 {
 	return static_cast<int32_t>(a) & static_cast<int32_t>(b);
@@ -82,6 +91,7 @@ public:
 	struct RequestedSubscription {
 		uint16_t interval_ms;
 		uint8_t instance;
+		TopicPriority priority{TopicPriority::Low};
 		ORB_ID id{ORB_ID::INVALID};
 	};
 	struct RequestedSubscriptionArray {
@@ -108,6 +118,13 @@ public:
 
 	void set_rate_factor(float rate_factor) { _rate_factor = rate_factor; }
 
+	/**
+	 * Get the priority of a topic. The main estimator outputs and control topics are high priority,
+	 * everything else (including the estimator diagnostics) is low priority.
+	 * @param name topic name
+	 */
+	static TopicPriority topic_priority(const char *name);
+
 private:
 
 	/**
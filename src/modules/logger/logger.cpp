@@ -244,6 +244,17 @@ void Logger::print_statistics(LogType type)
 
 	PX4_INFO("Since last status: dropouts: %zu (max len: %.3f s), max used buffer: %zu / %zu B",
 		 stats.write_dropouts, (double)stats.max_dropout_duration, stats.high_water, _writer.get_buffer_size_file(type));
+
+	if (_throttle_level > 0) {
+		PX4_INFO("Low-priority topics throttled (rate 1/%i)", 1 << _throttle_level);
+	}
+
+	if (type == LogType::Full) {
+		PX4_INFO("Topic samples written in-place: %" PRIu32 ", staged: %" PRIu32, _in_place_writes, _staged_writes);
+		_in_place_writes = 0;
+		_staged_writes = 0;
+	}
+
 	stats.high_water = 0;
 	stats.write_dropouts = 0;
 	stats.max_dropout_duration = 0.f;
@@ -415,7 +426,18 @@ Logger::~Logger()
 	}
 
 	delete[](_msg_buffer);
+
+	if (_subscription_callbacks) {
+		for (int i = 0; i < _num_subscriptions; ++i) {
+			delete _subscription_callbacks[i];
+		}
+
+		delete[](_subscription_callbacks);
+	}
+
 	delete[](_subscriptions);
+
+	perf_free(_capture_perf);
 }
 
 void Logger::update_params()
@@ -560,7 +582,9 @@ bool Logger::initialize_topics()
 
 		for (int i = 0; i < logged_topics.subscriptions().count; ++i) {
 			const LoggedTopics::RequestedSubscription &sub = logged_topics.subscriptions().sub[i];
-			_subscriptions[i] = LoggerSubscription(sub.id, sub.interval_ms, sub.instance);
+			// mission topics are never throttled, as they are shared with the mission log
+			const TopicPriority priority = (i < _num_mission_subs) ? TopicPriority::High : sub.priority;
+			_subscriptions[i] = LoggerSubscription(sub.id, sub.interval_ms, sub.instance, priority);
 			_subscriptions[i].subscribe();
 		}
 	}
@@ -569,6 +593,52 @@ bool Logger::initialize_topics()
 	return true;
 }
 
+void Logger::initialize_subscription_callbacks()
+{
+	_subscription_callbacks = new LoggerSubscriptionCallback *[_num_subscriptions] {};
+
+	if (!_subscription_callbacks) {
+		PX4_ERR("alloc failed");
+		return;
+	}
+
+	int num_callbacks = 0;
+
+	// mission topics are always polled
+	for (int i = _num_mission_subs; i < _num_subscriptions; ++i) {
+		LoggerSubscription &sub = _subscriptions[i];
+
+		if (sub.nominal_interval_ms < CALLBACK_MAX_INTERVAL_MS) {
+			sub.callback_pending = true;
+			++num_callbacks;
+		}
+	}
+
+	PX4_INFO("callback-driven capture: up to %i of %i topics", num_callbacks, _num_subscriptions);
+}
+
+void Logger::register_subscription_callback(int sub_idx)
+{
+	LoggerSubscription &sub = _subscriptions[sub_idx];
+	sub.callback_pending = false;
+
+	LoggerSubscriptionCallback *callback = new LoggerSubscriptionCallback(sub.get_topic(), sub.get_instance(),
+			_updated_topics, sub_idx);
+
+	// subscribe first: the topic exists already, so registerCallback() does not need to create it
+	if (callback && callback->subscribe() && callback->registerCallback()) {
+		_subscription_callbacks[sub_idx] = callback;
+		sub.callback_driven = true;
+
+		// catch up on data published before the callback got registered
+		_updated_topics.set(sub_idx);
+
+	} else {
+		// keep polling
+		delete callback;
+	}
+}
+
 void Logger::run()
 {
 	PX4_INFO("logger started (mode=%s)", configured_backend_mode());
@@ -599,6 +669,10 @@ void Logger::run()
 		return;
 	}
 
+	if (_param_sdlog_cb_capture.get()) {
+		initialize_subscription_callbacks();
+	}
+
 	//all topics added. Get required message buffer size
 	int max_msg_size = 0;
 
@@ -720,6 +794,12 @@ void Logger::run()
 		if (_writer.is_started(LogType::Full)) { // mission log only runs when full log is also started
 
 			if (!was_started) {
+				// start every log at nominal rates
+				if (_throttle_level != 0) {
+					_throttle_level = 0;
+					apply_throttle_level();
+				}
+
 				adjust_subscription_updates();
 			}
 
@@ -749,53 +829,33 @@ void Logger::run()
 			/* wait for lock on log buffer */
 			_writer.lock();
 
+			perf_begin(_capture_perf);
+
 			for (int sub_idx = 0; sub_idx < _num_subscriptions; ++sub_idx) {
-				LoggerSubscription &sub = _subscriptions[sub_idx];
+				if (_subscriptions[sub_idx].callback_driven) {
+					continue; // handled below
+				}
+
 				/* if this topic has been updated, copy the new data into the message buffer
 				 * and write a message to the log
 				 */
 				const bool try_to_subscribe = (sub_idx == next_subscribe_topic_index);
 
-				if (copy_if_updated(sub_idx, _msg_buffer + sizeof(ulog_message_data_s), try_to_subscribe)) {
-					// each message consists of a header followed by an orb data object
-					const size_t msg_size = sizeof(ulog_message_data_s) + sub.get_topic()->o_size_no_padding;
-					const uint16_t write_msg_size = static_cast<uint16_t>(msg_size - ULOG_MSG_HEADER_LEN);
-					const uint16_t write_msg_id = sub.msg_id;
-
-					//write one byte after another (necessary because of alignment)
-					_msg_buffer[0] = (uint8_t)write_msg_size;
-					_msg_buffer[1] = (uint8_t)(write_msg_size >> 8);
-					_msg_buffer[2] = static_cast<uint8_t>(ULogMessageType::DATA);
-					_msg_buffer[3] = (uint8_t)write_msg_id;
-					_msg_buffer[4] = (uint8_t)(write_msg_id >> 8);
-
-					// PX4_INFO("topic: %s, size = %zu, out_size = %zu", sub.get_topic()->o_name, sub.get_topic()->o_size, msg_size);
+				write_subscription(sub_idx, try_to_subscribe, loop_time, total_bytes);
 
-					// full log
-					if (write_message(LogType::Full, _msg_buffer, msg_size)) {
-
-#ifdef DBGPRINT
-						total_bytes += msg_size;
-#endif /* DBGPRINT */
-					}
-
-					// mission log
-					if (sub_idx < _num_mission_subs) {
-						if (_writer.is_started(LogType::Mission)) {
-							if (_mission_subscriptions[sub_idx].next_write_time < (loop_time / 100000)) {
-								unsigned delta_time = _mission_subscriptions[sub_idx].min_delta_ms;
-
-								if (delta_time > 0) {
-									_mission_subscriptions[sub_idx].next_write_time = (loop_time / 100000) + delta_time / 100;
-								}
+				LoggerSubscription &sub = _subscriptions[sub_idx];
 
-								write_message(LogType::Mission, _msg_buffer, msg_size);
-							}
-						}
-					}
+				if (sub.callback_pending && sub.valid() && sub.advertised()) {
+					register_subscription_callback(sub_idx);
 				}
 			}
 
+			if (_subscription_callbacks) {
+				write_updated_callback_subscriptions(loop_time, total_bytes);
+			}
+
+			perf_end(_capture_perf);
+
 			// check for new events
 			handle_event_updates(total_bytes);
 
@@ -807,19 +867,14 @@ void Logger::run()
 				int message_len = strlen(message);
 
 				if (message_len > 0) {
-					uint16_t write_msg_size = sizeof(ulog_message_logging_s) - sizeof(ulog_message_logging_s::message)
-								  - ULOG_MSG_HEADER_LEN + message_len;
-					_msg_buffer[0] = (uint8_t)write_msg_size;
-					_msg_buffer[1] = (uint8_t)(write_msg_size >> 8);
-					_msg_buffer[2] = static_cast<uint8_t>(ULogMessageType::LOGGING);
-					_msg_buffer[3] = log_message.severity + '0';
-					memcpy(_msg_buffer + 4, &log_message.timestamp, sizeof(ulog_message_logging_s::timestamp));
-					strncpy((char *)(_msg_buffer + 12), message, sizeof(ulog_message_logging_s::message));
-
-					write_message(LogType::Full, _msg_buffer, write_msg_size + ULOG_MSG_HEADER_LEN);
+					write_logging_message(LogType::Full, log_message.severity + '0', log_message.timestamp, message);
 				}
 			}
 
+			if (_param_sdlog_adapt_rate.get()) {
+				update_backpressure_throttling(loop_time);
+			}
+
 			// Add sync magic
 			if (loop_time - _last_sync_time > 500_ms) {
 				uint16_t write_msg_size = static_cast<uint16_t>(sizeof(ulog_message_sync_s) - ULOG_MSG_HEADER_LEN);
@@ -951,6 +1006,111 @@ void Logger::run()
 	px4_unregister_shutdown_hook(&Logger::request_stop_static);
 }
 
+bool Logger::write_subscription(int sub_idx, bool try_to_subscribe, const hrt_abstime &loop_time,
+				uint32_t &total_bytes)
+{
+	LoggerSubscription &sub = _subscriptions[sub_idx];
+
+	// Serialize directly into the write buffer if the topic is already subscribed (so nothing else gets written
+	// in between) and there is no dropout to be written first. Otherwise the sample is staged in _msg_buffer.
+	if (sub.valid() && (sub.msg_id != MSG_ID_INVALID) && (_statistics[(int)LogType::Full].dropout_start == 0)) {
+		uint8_t *msg = _writer.reserve_message(LogType::Full, sub.copy_plan.copy_size);
+
+		if (msg) {
+			if (!copy_if_updated(sub_idx, msg + sizeof(ulog_message_data_s), false)) {
+				return false;
+			}
+
+			memcpy(msg, sub.copy_plan.header, sizeof(sub.copy_plan.header));
+			_writer.commit_message(LogType::Full, sub.copy_plan.msg_size);
+			++_in_place_writes;
+
+#ifdef DBGPRINT
+			total_bytes += sub.copy_plan.msg_size;
+#endif /* DBGPRINT */
+
+			if (sub_idx < _num_mission_subs) {
+				write_mission_subscription_data(sub_idx, loop_time, msg, sub.copy_plan.msg_size);
+			}
+
+			return true;
+		}
+	}
+
+	if (copy_if_updated(sub_idx, _msg_buffer + sizeof(ulog_message_data_s), try_to_subscribe)) {
+		write_subscription_data(sub_idx, loop_time, total_bytes);
+		return true;
+	}
+
+	return false;
+}
+
+void Logger::write_subscription_data(int sub_idx, const hrt_abstime &loop_time, uint32_t &total_bytes)
+{
+	LoggerSubscription &sub = _subscriptions[sub_idx];
+
+	// each message consists of a header followed by an orb data object
+	memcpy(_msg_buffer, sub.copy_plan.header, sizeof(sub.copy_plan.header));
+	const size_t msg_size = sub.copy_plan.msg_size;
+
+	++_staged_writes;
+
+	// full log
+	if (write_message(LogType::Full, _msg_buffer, msg_size)) {
+
+#ifdef DBGPRINT
+		total_bytes += msg_size;
+#endif /* DBGPRINT */
+	}
+
+	// mission log
+	if (sub_idx < _num_mission_subs) {
+		write_mission_subscription_data(sub_idx, loop_time, _msg_buffer, msg_size);
+	}
+}
+
+void Logger::write_mission_subscription_data(int sub_idx, const hrt_abstime &loop_time, uint8_t *msg, size_t msg_size)
+{
+	if (_writer.is_started(LogType::Mission)) {
+		if (_mission_subscriptions[sub_idx].next_write_time < (loop_time / 100000)) {
+			unsigned delta_time = _mission_subscriptions[sub_idx].min_delta_ms;
+
+			if (delta_time > 0) {
+				_mission_subscriptions[sub_idx].next_write_time = (loop_time / 100000) + delta_time / 100;
+			}
+
+			write_message(LogType::Mission, msg, msg_size);
+		}
+	}
+}
+
+void Logger::write_updated_callback_subscriptions(const hrt_abstime &loop_time, uint32_t &total_bytes)
+{
+	for (int word = 0; word < UpdatedTopics::NUM_WORDS; ++word) {
+		const uint32_t updated = _updated_topics.take(word);
+
+		if (updated == 0) {
+			continue;
+		}
+
+		for (int bit = 0; bit < 32; ++bit) {
+			if ((updated & (1u << bit)) == 0) {
+				continue;
+			}
+
+			const int sub_idx = word * 32 + bit;
+
+			// callbacks are only registered once the topic is subscribed and advertised
+			write_subscription(sub_idx, false, loop_time, total_bytes);
+
+			// data left over because of the logging interval or a queued topic: check again in the next iteration
+			if (_subscriptions[sub_idx].pending()) {
+				_updated_topics.set(sub_idx);
+			}
+		}
+	}
+}
+
 void Logger::debug_print_buffer(uint32_t &total_bytes, hrt_abstime &timer_start)
 {
 #ifdef DBGPRINT
@@ -1059,6 +1219,7 @@ void Logger::publish_logger_status()
 				status.message_gaps = _message_gaps;
 				status.buffer_used_bytes = buffer_fill_count_file;
 				status.buffer_size_bytes = _writer.get_buffer_size_file(log_type);
+				status.throttle_level = _throttle_level;
 			}
 
 			_logger_status_pub[i].publish(status);
@@ -1088,6 +1249,71 @@ void Logger::adjust_subscription_updates()
 	}
 }
 
+void Logger::update_backpressure_throttling(const hrt_abstime &now)
+{
+	// back-pressure is only measured on the file backend
+	const size_t buffer_size = _writer.get_buffer_size_file(LogType::Full);
+
+	if (buffer_size == 0) {
+		return;
+	}
+
+	const float buffer_fill = (float)_writer.get_buffer_fill_count_file(LogType::Full) / buffer_size;
+	const bool in_dropout = _statistics[(int)LogType::Full].dropout_start != 0;
+
+	uint8_t new_throttle_level = _throttle_level;
+
+	// react quickly on increasing pressure, but only restore the rates once the buffer stays drained (hysteresis)
+	if ((buffer_fill > 0.5f || in_dropout) && (now - _throttle_level_changed > 200_ms)) {
+		if (_throttle_level < MAX_THROTTLE_LEVEL) {
+			new_throttle_level = _throttle_level + 1;
+		}
+
+	} else if ((buffer_fill < 0.2f) && (now - _throttle_level_changed > 2_s)) {
+		if (_throttle_level > 0) {
+			new_throttle_level = _throttle_level - 1;
+		}
+	}
+
+	if (new_throttle_level != _throttle_level) {
+		_throttle_level = new_throttle_level;
+		_throttle_level_changed = now;
+		apply_throttle_level();
+
+		char message[sizeof(ulog_message_logging_s::message)];
+		snprintf(message, sizeof(message), "logger: low-priority topic rate 1/%i (buffer fill %i%%)",
+			 1 << _throttle_level, (int)(buffer_fill * 100.f));
+		write_logging_message(LogType::Full, '0' + 6, now, message); // 6: info
+	}
+}
+
+void Logger::apply_throttle_level()
+{
+	for (int i = 0; i < _num_subscriptions; ++i) {
+		LoggerSubscription &sub = _subscriptions[i];
+
+		// full rate (interval 0) topics are not throttled: these are typically event-like topics
+		if (sub.priority == TopicPriority::Low && sub.nominal_interval_ms > 0) {
+			sub.set_interval_ms((uint32_t)sub.nominal_interval_ms << _throttle_level);
+		}
+	}
+}
+
+void Logger::write_logging_message(LogType type, uint8_t log_level, uint64_t timestamp, const char *message)
+{
+	const int message_len = strnlen(message, sizeof(ulog_message_logging_s::message));
+	const uint16_t write_msg_size = sizeof(ulog_message_logging_s) - sizeof(ulog_message_logging_s::message)
+					- ULOG_MSG_HEADER_LEN + message_len;
+	_msg_buffer[0] = (uint8_t)write_msg_size;
+	_msg_buffer[1] = (uint8_t)(write_msg_size >> 8);
+	_msg_buffer[2] = static_cast<uint8_t>(ULogMessageType::LOGGING);
+	_msg_buffer[3] = log_level;
+	memcpy(_msg_buffer + 4, &timestamp, sizeof(ulog_message_logging_s::timestamp));
+	memcpy(_msg_buffer + 12, message, message_len);
+
+	write_message(type, _msg_buffer, write_msg_size + ULOG_MSG_HEADER_LEN);
+}
+
 bool Logger::get_disable_boot_logging()
 {
 	if (_param_sdlog_boot_bat.get()) {
@@ -1847,6 +2073,7 @@ void Logger::write_add_logged_msg(LogType type, LoggerSubscription &subscription
 		}
 
 		subscription.msg_id = _next_topic_id++;
+		subscription.init_copy_plan();
 	}
 
 	msg.msg_id = subscription.msg_id;
@@ -48,7 +48,10 @@
 #include <px4_platform_common/module_params.h>
 
 #include <uORB/PublicationMulti.hpp>
+#include <perf/perf_counter.h>
+#include <px4_platform_common/atomic.h>
 #include <uORB/Subscription.hpp>
+#include <uORB/SubscriptionCallback.hpp>
 #include <uORB/SubscriptionInterval.hpp>
 #include <uORB/topics/logger_status.h>
 #include <uORB/topics/log_message.h>
@@ -74,11 +77,89 @@ static constexpr uint8_t MSG_ID_INVALID = UINT8_MAX;
 struct LoggerSubscription : public uORB::SubscriptionInterval {
 	LoggerSubscription() = default;
 
-	LoggerSubscription(ORB_ID id, uint32_t interval_ms = 0, uint8_t instance = 0) :
-		uORB::SubscriptionInterval(id, interval_ms * 1000, instance)
+	LoggerSubscription(ORB_ID id, uint32_t interval_ms = 0, uint8_t instance = 0,
+			   TopicPriority topic_priority = TopicPriority::High) :
+		uORB::SubscriptionInterval(id, interval_ms * 1000, instance),
+		nominal_interval_ms(interval_ms),
+		priority(topic_priority)
 	{}
 
+	/**
+	 * Check if there is unread data, independent of the logging interval
+	 */
+	bool pending() { return _subscription.updated(); }
+
+	/**
+	 * Precompute the serialization of a sample into a ULog data message, once the msg_id is known.
+	 * The fields of uORB structs are sorted by size, so the only difference to the ULog format
+	 * is the padding at the end, which is simply not committed to the log.
+	 */
+	void init_copy_plan()
+	{
+		const uint16_t msg_size = sizeof(ulog_message_data_s) + get_topic()->o_size_no_padding;
+		const uint16_t write_msg_size = msg_size - ULOG_MSG_HEADER_LEN;
+
+		copy_plan.header[0] = (uint8_t)write_msg_size;
+		copy_plan.header[1] = (uint8_t)(write_msg_size >> 8);
+		copy_plan.header[2] = static_cast<uint8_t>(ULogMessageType::DATA);
+		copy_plan.header[3] = (uint8_t)msg_id;
+		copy_plan.header[4] = (uint8_t)(msg_id >> 8);
+		copy_plan.msg_size = msg_size;
+		copy_plan.copy_size = sizeof(ulog_message_data_s) + get_topic()->o_size;
+	}
+
+	struct CopyPlan {
+		uint8_t header[sizeof(ulog_message_data_s)] {}; ///< ULog message header including the msg_id
+		uint16_t msg_size{0};  ///< size of the ULog message (header and data without padding)
+		uint16_t copy_size{0}; ///< space needed to copy a sample (header and data including padding)
+	};
+
+	CopyPlan copy_plan{};
+	uint16_t nominal_interval_ms{0}; ///< configured logging interval, without back-pressure throttling
 	uint8_t msg_id{MSG_ID_INVALID};
+	TopicPriority priority{TopicPriority::High};
+	bool callback_driven{false}; ///< if true, updates are signalled via uORB callback instead of being polled
+	bool callback_pending{false}; ///< high-rate topic that switches to callback-driven capture once advertised
+};
+
+/**
+ * Set of subscription indexes with new data. Filled from uORB callbacks (in the context of the publisher)
+ * and drained by the logger thread, without locking.
+ */
+class UpdatedTopics
+{
+public:
+	static constexpr int NUM_WORDS = (LoggedTopics::MAX_TOPICS_NUM + 31) / 32;
+
+	void set(int index) { _bits[index / 32].fetch_or(1u << (index % 32)); }
+
+	/**
+	 * Atomically get and clear the update flags of the subscription indexes [word * 32, word * 32 + 31]
+	 */
+	uint32_t take(int word) { return _bits[word].fetch_and(0u); }
+
+private:
+	px4::atomic<uint32_t> _bits[NUM_WORDS] {};
+};
+
+/**
+ * uORB callback for a high-rate logged topic: only marks the subscription as updated,
+ * so that the publisher is not slowed down. The data is copied by the logger thread.
+ */
+class LoggerSubscriptionCallback : public uORB::SubscriptionCallback
+{
+public:
+	LoggerSubscriptionCallback(const orb_metadata *meta, uint8_t instance, UpdatedTopics &updated_topics, int sub_idx) :
+		uORB::SubscriptionCallback(meta, 0, instance),
+		_updated_topics(updated_topics),
+		_sub_idx(sub_idx)
+	{}
+
+	void call() override { _updated_topics.set(_sub_idx); }
+
+private:
+	UpdatedTopics &_updated_topics;
+	const int _sub_idx;
 };
 
 class Logger : public ModuleBase<Logger>, public ModuleParams
@@ -156,6 +237,8 @@ public:
 private:
 
 	static constexpr int		MAX_MISSION_TOPICS_NUM = 5; /**< Maximum number of mission topics */
+	static constexpr uint8_t	MAX_THROTTLE_LEVEL = 4; /**< Maximum back-pressure throttling level (interval x 2^level) */
+	static constexpr uint16_t	CALLBACK_MAX_INTERVAL_MS = 20; /**< Topics logged at a higher rate use callback-driven capture */
 	static constexpr unsigned	MAX_NO_LOGFILE = 999;	/**< Maximum number of log files */
 	static constexpr const char	*LOG_ROOT[(int)LogType::Count] = {
 		CONFIG_BOARD_ROOT_PATH "/log",
@@ -280,6 +363,45 @@ private:
 
 	inline bool copy_if_updated(int sub_idx, void *buffer, bool try_to_subscribe);
 
+	/**
+	 * Copy a subscription if updated and write it to the full log, and to the mission log if it is a mission topic.
+	 * If possible the sample is copied directly into the write buffer using the subscription's copy plan,
+	 * otherwise it is staged in _msg_buffer first.
+	 * Must be called with _writer.lock() held.
+	 * @return true if the subscription was updated
+	 */
+	inline bool write_subscription(int sub_idx, bool try_to_subscribe, const hrt_abstime &loop_time,
+				       uint32_t &total_bytes);
+
+	/**
+	 * Write the data of a subscription that was copied to _msg_buffer by copy_if_updated()
+	 * to the full log, and to the mission log if it is a mission topic.
+	 * Must be called with _writer.lock() held.
+	 */
+	inline void write_subscription_data(int sub_idx, const hrt_abstime &loop_time, uint32_t &total_bytes);
+
+	/**
+	 * Write a complete ULog data message of a mission topic to the mission log, respecting its logging interval.
+	 */
+	inline void write_mission_subscription_data(int sub_idx, const hrt_abstime &loop_time, uint8_t *msg, size_t msg_size);
+
+	/**
+	 * Select the high-rate topics for callback-driven capture. They are polled until they get advertised,
+	 * then register_subscription_callback() switches them over. The remaining topics are always polled.
+	 */
+	void initialize_subscription_callbacks();
+
+	/**
+	 * Register the uORB callback of an advertised high-rate topic.
+	 */
+	void register_subscription_callback(int sub_idx);
+
+	/**
+	 * Copy and write all callback-driven subscriptions that got updated since the last call.
+	 * Must be called with _writer.lock() held.
+	 */
+	void write_updated_callback_subscriptions(const hrt_abstime &loop_time, uint32_t &total_bytes);
+
 	/**
 	 * Write exactly one ulog message to the logger and handle dropouts.
 	 * Must be called with _writer.lock() held.
@@ -338,6 +460,24 @@ private:
 
 	void adjust_subscription_updates();
 
+	/**
+	 * Reduce the logging rate of low-priority topics while the file write buffer is filling up,
+	 * and restore it once the pressure is gone. Every change is recorded in the log.
+	 * Must be called with _writer.lock() held.
+	 */
+	void update_backpressure_throttling(const hrt_abstime &now);
+
+	/**
+	 * Apply the current throttling level to the logging interval of all low-priority subscriptions.
+	 */
+	void apply_throttle_level();
+
+	/**
+	 * Write a ulog logging (string) message.
+	 * Must be called with _writer.lock() held.
+	 */
+	void write_logging_message(LogType type, uint8_t log_level, uint64_t timestamp, const char *message);
+
 	uint8_t						*_msg_buffer{nullptr};
 	int						_msg_buffer_len{0};
 
@@ -354,6 +494,8 @@ private:
 
 	LoggerSubscription	 			*_subscriptions{nullptr}; ///< all subscriptions for full & mission log (in front)
 	int						_num_subscriptions{0};
+	LoggerSubscriptionCallback			**_subscription_callbacks{nullptr}; ///< callbacks for high-rate subscriptions (same index as _subscriptions)
+	UpdatedTopics					_updated_topics; ///< callback-driven subscriptions with new data
 	MissionSubscription 				_mission_subscriptions[MAX_MISSION_TOPICS_NUM] {}; ///< additional data for mission subscriptions
 	int						_num_mission_subs{0};
 	LoggerSubscription				_event_subscription; ///< Subscription for the event topic (handled separately)
@@ -382,6 +524,13 @@ private:
 	int						_lockstep_component{-1};
 
 	uint32_t					_message_gaps{0};
+	uint32_t					_in_place_writes{0}; ///< topic samples serialized directly into the write buffer
+	uint32_t					_staged_writes{0}; ///< topic samples copied to _msg_buffer first
+
+	perf_counter_t					_capture_perf{perf_alloc(PC_ELAPSED, "logger: capture")};
+
+	uint8_t						_throttle_level{0}; ///< current back-pressure throttling level (0 = nominal rates)
+	hrt_abstime					_throttle_level_changed{0}; ///< time of the last throttling level change
 
 	timer_callback_data_s				_timer_callback_data{};
 
@@ -397,7 +546,9 @@ private:
 		(ParamInt<px4::params::SDLOG_PROFILE>) _param_sdlog_profile,
 		(ParamInt<px4::params::SDLOG_MISSION>) _param_sdlog_mission,
 		(ParamBool<px4::params::SDLOG_BOOT_BAT>) _param_sdlog_boot_bat,
-		(ParamBool<px4::params::SDLOG_UUID>) _param_sdlog_uuid
+		(ParamBool<px4::params::SDLOG_UUID>) _param_sdlog_uuid,
+		(ParamBool<px4::params::SDLOG_ADAPT_RATE>) _param_sdlog_adapt_rate,
+		(ParamBool<px4::params::SDLOG_CB_CAPTURE>) _param_sdlog_cb_capture
 #if defined(PX4_CRYPTO)
 		, (ParamInt<px4::params::SDLOG_ALGORITHM>) _param_sdlog_crypto_algorithm,
 		(ParamInt<px4::params::SDLOG_KEY>) _param_sdlog_crypto_key,
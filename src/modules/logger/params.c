@@ -146,6 +146,32 @@ PARAM_DEFINE_INT32(SDLOG_MISSION, 0);
  */
 PARAM_DEFINE_INT32(SDLOG_PROFILE, 1);
 
+/**
+ * Adaptive logging rate
+ *
+ * If enabled, the logging rate of low-priority topics is reduced when the SD card
+ * cannot keep up and the write buffer fills up. Estimator and control topics are always
+ * logged at their configured rate. The rates are restored once the buffer drains, and
+ * every rate change is recorded in the log.
+ *
+ * @boolean
+ * @group SD Logging
+ */
+PARAM_DEFINE_INT32(SDLOG_ADAPT_RATE, 0);
+
+/**
+ * Callback-driven topic capture
+ *
+ * If enabled, high-rate logged topics (logging interval below 20 ms) signal new data via uORB
+ * callbacks, and the logger only copies the topics that actually got updated, instead of checking
+ * every subscription on each logger iteration. Low-rate topics are still polled.
+ *
+ * @boolean
+ * @reboot_required true
+ * @group SD Logging
+ */
+PARAM_DEFINE_INT32(SDLOG_CB_CAPTURE, 0);
+
 /**
  * Maximum number of log directories to keep
  *
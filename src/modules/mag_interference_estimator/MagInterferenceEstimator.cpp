@@ -0,0 +1,278 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include "MagInterferenceEstimator.hpp"
+
+using namespace time_literals;
+using matrix::Vector3f;
+
+namespace mag_interference_estimator
+{
+
+MagInterferenceEstimator::MagInterferenceEstimator() :
+	ModuleParams(nullptr),
+	ScheduledWorkItem(MODULE_NAME, px4::wq_configurations::lp_default)
+{
+	_magnetometer_interference_estimate_pub.advertise();
+
+	for (auto &estimator : _interference_estimator) {
+		estimator.setExcitationMin(FieldSensorInterferenceEstimator::Inputs{EXCITATION_MIN_CURRENT, EXCITATION_MIN_THROTTLE});
+	}
+}
+
+MagInterferenceEstimator::~MagInterferenceEstimator()
+{
+	perf_free(_cycle_perf);
+	perf_free(_fit_perf);
+}
+
+int MagInterferenceEstimator::task_spawn(int argc, char *argv[])
+{
+	MagInterferenceEstimator *obj = new MagInterferenceEstimator();
+
+	if (!obj) {
+		PX4_ERR("alloc failed");
+		return -1;
+	}
+
+	_object.store(obj);
+	_task_id = task_id_is_work_queue;
+
+	/* Schedule a cycle to start things. */
+	obj->start();
+
+	return 0;
+}
+
+void MagInterferenceEstimator::start()
+{
+	ScheduleOnInterval(20_ms); // 50 Hz
+}
+
+void MagInterferenceEstimator::Run()
+{
+	if (should_exit()) {
+		ScheduleClear();
+		exit_and_cleanup();
+	}
+
+	if (_vehicle_status_sub.updated()) {
+		vehicle_status_s vehicle_status;
+
+		if (_vehicle_status_sub.copy(&vehicle_status)) {
+			bool system_calibrating = vehicle_status.calibration_enabled;
+
+			if (system_calibrating != _system_calibrating) {
+				_system_calibrating = system_calibrating;
+
+				for (auto &estimator : _interference_estimator) {
+					estimator.reset();
+				}
+			}
+		}
+	}
+
+	// check for parameter updates
+	if (_parameter_update_sub.updated()) {
+		// clear update
+		parameter_update_s pupdate;
+		_parameter_update_sub.copy(&pupdate);
+
+		// update parameters from storage
+		updateParams();
+
+		for (int mag_index = 0; mag_index < MAX_SENSOR_COUNT; mag_index++) {
+			const auto calibration_count = _calibration[mag_index].calibration_count();
+			_calibration[mag_index].ParametersUpdate();
+
+			if (calibration_count != _calibration[mag_index].calibration_count()) {
+				_interference_estimator[mag_index].reset();
+			}
+
+			_interference_estimator[mag_index].setForgettingFactor(_param_mie_forget.get());
+		}
+	}
+
+	// do nothing during regular sensor calibration
+	if (_system_calibrating) {
+		return;
+	}
+
+	perf_begin(_cycle_perf);
+
+	_inputs.update();
+
+	// Assume a constant angular velocity during two mag samples
+	vehicle_angular_velocity_s vehicle_angular_velocity;
+
+	if (_vehicle_angular_velocity_sub.update(&vehicle_angular_velocity)) {
+
+		const Vector3f angular_velocity{vehicle_angular_velocity.xyz};
+
+		bool updated = false;
+
+		for (int mag_index = 0; mag_index < MAX_SENSOR_COUNT; mag_index++) {
+			int sensor_mag_updates = 0;
+			sensor_mag_s sensor_mag;
+
+			while ((sensor_mag_updates < sensor_mag_s::ORB_QUEUE_LENGTH) && _sensor_mag_subs[mag_index].update(&sensor_mag)) {
+				sensor_mag_updates++;
+
+				if (_calibration[mag_index].device_id() != sensor_mag.device_id) {
+					_calibration[mag_index].set_device_id(sensor_mag.device_id);
+					_interference_estimator[mag_index].reset();
+				}
+
+				// apply existing mag calibration (without the static interference compensation)
+				const Vector3f mag_calibrated = _calibration[mag_index].Correct(Vector3f{sensor_mag.x, sensor_mag.y, sensor_mag.z});
+
+				const float dt = (sensor_mag.timestamp_sample - _timestamp_last_update[mag_index]) * 1e-6f;
+				_timestamp_last_update[mag_index] = sensor_mag.timestamp_sample;
+
+				if (dt < 0.001f || dt > 0.2f) {
+					_interference_estimator[mag_index].resetDifferences();
+				}
+
+				if (_interference_estimator[mag_index].updateEstimate(angular_velocity, mag_calibrated, _inputs.get(), dt)) {
+					perf_count(_fit_perf);
+					updated = true;
+
+					const auto &coefficients = _interference_estimator[mag_index].getCoefficients();
+
+					if (!coefficients.isAllFinite() || (coefficients.abs().max() > 100.f)) {
+						_interference_estimator[mag_index].reset();
+					}
+				}
+			}
+		}
+
+		if (updated) {
+			publishMagInterferenceEstimate();
+		}
+	}
+
+	perf_end(_cycle_perf);
+}
+
+void MagInterferenceEstimator::publishMagInterferenceEstimate()
+{
+	magnetometer_interference_estimate_s mag_interference_est{};
+
+	for (int mag_index = 0; mag_index < MAX_SENSOR_COUNT; mag_index++) {
+		const FieldSensorInterferenceEstimator &estimator = _interference_estimator[mag_index];
+		const auto &coefficients = estimator.getCoefficients();
+
+		mag_interference_est.device_id[mag_index] = _calibration[mag_index].device_id();
+
+		mag_interference_est.current_x[mag_index] = coefficients(0, 0);
+		mag_interference_est.current_y[mag_index] = coefficients(1, 0);
+		mag_interference_est.current_z[mag_index] = coefficients(2, 0);
+
+		mag_interference_est.throttle_x[mag_index] = coefficients(0, 1);
+		mag_interference_est.throttle_y[mag_index] = coefficients(1, 1);
+		mag_interference_est.throttle_z[mag_index] = coefficients(2, 1);
+
+		mag_interference_est.fit_quality[mag_index] = estimator.getFitQuality();
+		mag_interference_est.residual_rms[mag_index] = estimator.getResidualRms();
+		mag_interference_est.update_count[mag_index] = estimator.updateCount();
+
+		// latch with hysteresis on the fit quality, a marginal fit must not toggle the compensation
+		if (estimator.updateCount() < UPDATES_VALID_MIN) {
+			_valid[mag_index] = false;
+
+		} else if (estimator.getFitQuality() >= FIT_QUALITY_VALID_MIN) {
+			_valid[mag_index] = true;
+
+		} else if (estimator.getFitQuality() < FIT_QUALITY_INVALID_MAX) {
+			_valid[mag_index] = false;
+		}
+
+		mag_interference_est.valid[mag_index] = _valid[mag_index];
+	}
+
+	mag_interference_est.timestamp = hrt_absolute_time();
+	_magnetometer_interference_estimate_pub.publish(mag_interference_est);
+}
+
+int MagInterferenceEstimator::print_status()
+{
+	PX4_INFO("current: %.3f kA, throttle: %.3f", (double)_inputs.current(), (double)_inputs.throttle());
+
+	for (int mag_index = 0; mag_index < MAX_SENSOR_COUNT; mag_index++) {
+		if (_calibration[mag_index].device_id() != 0) {
+			const FieldSensorInterferenceEstimator &estimator = _interference_estimator[mag_index];
+			const auto &coefficients = estimator.getCoefficients();
+
+			PX4_INFO("%d (%" PRIu32 ") current: [% 05.3f % 05.3f % 05.3f] throttle: [% 05.3f % 05.3f % 05.3f] fit: %.2f (%d)",
+				 mag_index, _calibration[mag_index].device_id(),
+				 (double)coefficients(0, 0), (double)coefficients(1, 0), (double)coefficients(2, 0),
+				 (double)coefficients(0, 1), (double)coefficients(1, 1), (double)coefficients(2, 1),
+				 (double)estimator.getFitQuality(), estimator.updateCount());
+		}
+	}
+
+	perf_print_counter(_cycle_perf);
+	perf_print_counter(_fit_perf);
+
+	return 0;
+}
+
+int MagInterferenceEstimator::print_usage(const char *reason)
+{
+	if (reason) {
+		PX4_ERR("%s\n", reason);
+	}
+
+	PRINT_MODULE_DESCRIPTION(
+		R"DESCR_STR(
+### Description
+Online magnetometer interference estimator.
+
+Fits the linear interference of the battery current and of the motor throttle on each magnetometer,
+using the gyro to remove the field changes caused by the vehicle rotation. The coefficients and the fit
+quality are published as magnetometer_interference_estimate and applied by the sensors module once valid.
+)DESCR_STR");
+
+	PRINT_MODULE_USAGE_NAME("mag_interference_estimator", "system");
+	PRINT_MODULE_USAGE_COMMAND_DESCR("start", "Start the background task");
+	PRINT_MODULE_USAGE_DEFAULT_COMMANDS();
+	return 0;
+}
+
+extern "C" __EXPORT int mag_interference_estimator_main(int argc, char *argv[])
+{
+	return MagInterferenceEstimator::main(argc, argv);
+}
+
+} // namespace mag_interference_estimator
@@ -0,0 +1,63 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * Enable online mag interference estimation
+ *
+ * This enables the online estimation of the magnetometer interference
+ * caused by the battery current and the motor throttle, using gyro data.
+ * Once the fit is good enough, the compensation is applied by the sensors
+ * module (only if the static compensation CAL_MAG_COMP_TYP is disabled).
+ *
+ * @boolean
+ * @reboot_required true
+ * @group Magnetometer Interference Estimator
+ */
+PARAM_DEFINE_INT32(MIE_ENABLE, 0);
+
+/**
+ * Mag interference estimator forgetting factor
+ *
+ * Forgetting factor of the recursive least squares fit, applied for
+ * every sample with sufficient current or throttle change.
+ * Decrease to track changing interference faster,
+ * increase to make the estimate more robust to noise.
+ *
+ * @min 0.9
+ * @max 1.0
+ * @decimal 4
+ * @increment 0.0001
+ * @group Magnetometer Interference Estimator
+ */
+PARAM_DEFINE_FLOAT(MIE_FORGET, 0.999f);
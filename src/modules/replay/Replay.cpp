@@ -49,6 +49,7 @@
 #include <lib/parameters/param.h>
 #include <uORB/uORBMessageFields.hpp>
 
+#include <chrono>
 #include <cstring>
 #include <float.h>
 #include <fstream>
@@ -545,15 +546,21 @@ Replay::readAndAddSubscription(std::ifstream &file, uint16_t msg_size)
 	}
 
 	//find first data message (and the timestamp)
-	streampos cur_pos = file.tellg();
-	subscription->next_read_pos = this_message_pos; //this will be skipped
+	if (_index.valid()) {
+		subscription->next_index = 0;
+		nextIndexedDataMessage(*subscription, msg_id, false);
 
-	if (!nextDataMessage(file, *subscription, msg_id)) {
-		delete subscription;
-		return false;
-	}
+	} else {
+		streampos cur_pos = file.tellg();
+		subscription->next_read_pos = this_message_pos; //this will be skipped
 
-	file.seekg(cur_pos);
+		if (!nextDataMessage(file, *subscription, msg_id)) {
+			delete subscription;
+			return false;
+		}
+
+		file.seekg(cur_pos);
+	}
 
 	if (!subscription->orb_meta) {
 		//no message found. This is not a fatal error
@@ -609,31 +616,40 @@ Replay::findFieldOffset(const string &format, const string &field_name, int &off
 bool
 Replay::readAndHandleAdditionalMessages(std::ifstream &file, std::streampos end_position)
 {
-	ulog_message_header_s message_header;
-
 	while (file.tellg() < end_position) {
-		file.read((char *)&message_header, ULOG_MSG_HEADER_LEN);
-
-		if (!file) {
+		if (!readAndHandleAdditionalMessage(file)) {
 			return false;
 		}
+	}
 
-		switch (message_header.msg_type) {
-		case (int)ULogMessageType::PARAMETER:
-			if (!readAndApplyParameter(file, message_header.msg_size)) {
-				return false;
-			}
+	return true;
+}
 
-			break;
+bool
+Replay::readAndHandleAdditionalMessage(std::ifstream &file)
+{
+	ulog_message_header_s message_header;
+	file.read((char *)&message_header, ULOG_MSG_HEADER_LEN);
 
-		case (int)ULogMessageType::DROPOUT:
-			readDropout(file, message_header.msg_size);
-			break;
+	if (!file) {
+		return false;
+	}
 
-		default: //skip all others
-			file.seekg(message_header.msg_size, ios::cur);
-			break;
+	switch (message_header.msg_type) {
+	case (int)ULogMessageType::PARAMETER:
+		if (!readAndApplyParameter(file, message_header.msg_size)) {
+			return false;
 		}
+
+		break;
+
+	case (int)ULogMessageType::DROPOUT:
+		readDropout(file, message_header.msg_size);
+		break;
+
+	default: //skip all others
+		file.seekg(message_header.msg_size, ios::cur);
+		break;
 	}
 
 	return true;
@@ -695,6 +711,10 @@ Replay::readDropout(std::ifstream &file, uint16_t msg_size)
 bool
 Replay::nextDataMessage(std::ifstream &file, Subscription &subscription, int msg_id)
 {
+	if (_index.valid()) {
+		return nextIndexedDataMessage(subscription, msg_id, true);
+	}
+
 	ulog_message_header_s message_header;
 	file.seekg(subscription.next_read_pos);
 	//ignore the first message (it's data we already read)
@@ -778,6 +798,120 @@ Replay::nextDataMessage(std::ifstream &file, Subscription &subscription, int msg
 	return file.good();
 }
 
+bool
+Replay::nextIndexedDataMessage(Subscription &subscription, int msg_id, bool skip_current)
+{
+	const std::vector<uint64_t> &data_messages = _index.dataMessages(msg_id);
+
+	if (skip_current) {
+		++subscription.next_index;
+	}
+
+	while (subscription.next_index < data_messages.size()) {
+		const uint64_t pos = data_messages[subscription.next_index];
+		ulog_message_header_s message_header;
+		memcpy(&message_header, _index.data() + pos, ULOG_MSG_HEADER_LEN);
+
+		if (message_header.msg_size == subscription.orb_meta->o_size_no_padding + 2) {
+			subscription.next_read_pos = pos;
+			memcpy(&subscription.next_timestamp, _index.data() + pos + ULOG_MSG_HEADER_LEN + 2 + subscription.timestamp_offset,
+			       sizeof(subscription.next_timestamp));
+			return true;
+		}
+
+		//sanity check failed!
+		PX4_ERR("data message %s has wrong size %i (expected %i). Skipping",
+			subscription.orb_meta->o_name, message_header.msg_size,
+			subscription.orb_meta->o_size_no_padding + 2);
+		++subscription.next_index;
+	}
+
+	//no more data messages for this subscription
+	subscription.orb_meta = nullptr;
+	return true;
+}
+
+bool
+Replay::buildIndex()
+{
+	const auto start = std::chrono::steady_clock::now();
+
+	if (!_index.build(_replay_file, (streamoff)_data_section_start, _read_until_file_position)) {
+		PX4_WARN("Failed to index the replay file, reading it sequentially");
+		return false;
+	}
+
+	const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+	PX4_INFO("Indexed %zu data messages (%.1f MB) in %.3lf s", _index.numDataMessages(),
+		 (double)_index.fileSize() / 1.e6, elapsed.count());
+	return true;
+}
+
+int
+Replay::findNextSubscription(uint64_t &next_file_time)
+{
+	if (_index.valid()) {
+		while (!_publication_queue.empty()) {
+			const QueueEntry entry = _publication_queue.top();
+			_publication_queue.pop();
+
+			const Subscription *subscription = _subscriptions[entry.second];
+
+			if (!subscription->orb_meta || subscription->ignored) {
+				continue;
+			}
+
+			if (subscription->next_timestamp != entry.first) {
+				// subscription got advanced outside of the main loop
+				_publication_queue.push(QueueEntry{subscription->next_timestamp, entry.second});
+				continue;
+			}
+
+			next_file_time = entry.first;
+			return entry.second;
+		}
+
+		return -1;
+	}
+
+	//Messages from different subscriptions don't need to be in chronological order,
+	//so we need to check all subscriptions
+	int next_msg_id = -1;
+	bool first_time = true;
+
+	for (size_t i = 0; i < _subscriptions.size(); ++i) {
+		const Subscription *subscription = _subscriptions[i];
+
+		if (!subscription) {
+			continue;
+		}
+
+		if (subscription->orb_meta && !subscription->ignored) {
+			if (first_time || subscription->next_timestamp < next_file_time) {
+				first_time = false;
+				next_msg_id = (int)i;
+				next_file_time = subscription->next_timestamp;
+			}
+		}
+	}
+
+	return next_msg_id;
+}
+
+void
+Replay::queueSubscription(int msg_id)
+{
+	if (!_index.valid()) {
+		return;
+	}
+
+	const Subscription *subscription = _subscriptions[msg_id];
+
+	if (subscription && subscription->orb_meta && !subscription->ignored) {
+		_publication_queue.push(QueueEntry{subscription->next_timestamp, (uint16_t)msg_id});
+	}
+}
+
 const orb_metadata *
 Replay::findTopic(const std::string &name)
 {
@@ -905,43 +1039,46 @@ Replay::run()
 	PX4_INFO("Replay in progress...");
 
 	ulog_message_header_s message_header;
-	replay_file.seekg(_data_section_start);
 
-	//we know the next message must be an ADD_LOGGED_MSG
-	replay_file.read((char *)&message_header, ULOG_MSG_HEADER_LEN);
+	if (buildIndex()) {
+		// with the index all subscriptions can be added upfront
+		for (uint64_t subscription_pos : _index.subscriptionMessages()) {
+			replay_file.seekg(subscription_pos);
+			replay_file.read((char *)&message_header, ULOG_MSG_HEADER_LEN);
 
-	if (!readAndAddSubscription(replay_file, message_header.msg_size)) {
-		PX4_ERR("Failed to read subscription");
-		return;
+			if (!readAndAddSubscription(replay_file, message_header.msg_size)) {
+				PX4_ERR("Failed to read subscription");
+				return;
+			}
+		}
+
+		for (size_t i = 0; i < _subscriptions.size(); ++i) {
+			queueSubscription(i);
+		}
+
+	} else {
+		replay_file.seekg(_data_section_start);
+
+		//we know the next message must be an ADD_LOGGED_MSG
+		replay_file.read((char *)&message_header, ULOG_MSG_HEADER_LEN);
+
+		if (!readAndAddSubscription(replay_file, message_header.msg_size)) {
+			PX4_ERR("Failed to read subscription");
+			return;
+		}
 	}
 
+	const auto replay_start_wall_time = std::chrono::steady_clock::now();
+
 	const uint64_t timestamp_offset = getTimestampOffset();
 	uint32_t nr_published_messages = 0;
 	streampos last_additional_message_pos = _data_section_start;
 
 	while (!should_exit() && replay_file) {
 
-		//Find the next message to publish. Messages from different subscriptions don't need
-		//to be in chronological order, so we need to check all subscriptions
+		//Find the next message to publish
 		uint64_t next_file_time = 0;
-		int next_msg_id = -1;
-		bool first_time = true;
-
-		for (size_t i = 0; i < _subscriptions.size(); ++i) {
-			const Subscription *subscription = _subscriptions[i];
-
-			if (!subscription) {
-				continue;
-			}
-
-			if (subscription->orb_meta && !subscription->ignored) {
-				if (first_time || subscription->next_timestamp < next_file_time) {
-					first_time = false;
-					next_msg_id = (int)i;
-					next_file_time = subscription->next_timestamp;
-				}
-			}
-		}
+		const int next_msg_id = findNextSubscription(next_file_time);
 
 		if (next_msg_id == -1) {
 			break; //no active subscription anymore. We're done.
@@ -952,14 +1089,26 @@ Replay::run()
 		if (next_file_time == 0 || next_file_time < _file_start_time) {
 			//someone didn't set the timestamp properly. Consider the message invalid
 			nextDataMessage(replay_file, sub, next_msg_id);
+			queueSubscription(next_msg_id);
 			continue;
 		}
 
 		//handle additional messages between last and next published data
-		replay_file.seekg(last_additional_message_pos);
-		streampos next_additional_message_pos = sub.next_read_pos;
-		readAndHandleAdditionalMessages(replay_file, next_additional_message_pos);
-		last_additional_message_pos = next_additional_message_pos;
+		if (_index.valid()) {
+			const std::vector<uint64_t> &additional_messages = _index.additionalMessages();
+
+			while (_next_additional_message < additional_messages.size()
+			       && (streamoff)additional_messages[_next_additional_message] < (streamoff)sub.next_read_pos) {
+				replay_file.seekg(additional_messages[_next_additional_message++]);
+				readAndHandleAdditionalMessage(replay_file);
+			}
+
+		} else {
+			replay_file.seekg(last_additional_message_pos);
+			streampos next_additional_message_pos = sub.next_read_pos;
+			readAndHandleAdditionalMessages(replay_file, next_additional_message_pos);
+			last_additional_message_pos = next_additional_message_pos;
+		}
 
 		// Perform scheduled parameter changes
 		while (_next_param_change < _dynamic_parameter_schedule.size() &&
@@ -983,6 +1132,7 @@ Replay::run()
 		}
 
 		nextDataMessage(replay_file, sub, next_msg_id);
+		queueSubscription(next_msg_id);
 
 		// TODO: output status (eg. every sec), including total duration...
 	}
@@ -1006,6 +1156,16 @@ Replay::run()
 	if (!should_exit()) {
 		PX4_INFO("Replay done (published %u msgs, %.3lf s)", nr_published_messages,
 			 (double)hrt_elapsed_time(&_replay_start_time) / 1.e6);
+
+		const std::chrono::duration<double> wall_time = std::chrono::steady_clock::now() - replay_start_wall_time;
+
+		if (_index.valid() && wall_time.count() > 0.) {
+			PX4_INFO("Replay wall time: %.3lf s (%.1f MB/s)", wall_time.count(),
+				 (double)_index.fileSize() / 1.e6 / wall_time.count());
+
+		} else {
+			PX4_INFO("Replay wall time: %.3lf s", wall_time.count());
+		}
 	}
 
 	onExitMainLoop();
@@ -1031,6 +1191,12 @@ Replay::readTopicDataToBuffer(const Subscription &sub, std::ifstream &replay_fil
 	const size_t msg_read_size = sub.orb_meta->o_size_no_padding;
 	const size_t msg_write_size = sub.orb_meta->o_size;
 	_read_buffer.reserve(msg_write_size);
+
+	if (_index.valid()) {
+		memcpy(_read_buffer.data(), _index.data() + (streamoff)sub.next_read_pos + ULOG_MSG_HEADER_LEN + 2, msg_read_size);
+		return;
+	}
+
 	replay_file.seekg(sub.next_read_pos + (streamoff)(ULOG_MSG_HEADER_LEN + 2)); //skip header & msg id
 	replay_file.read((char *)_read_buffer.data(), msg_read_size);
 }
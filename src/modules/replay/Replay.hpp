@@ -35,12 +35,15 @@
 
 #include <algorithm>
 #include <fstream>
+#include <functional>
 #include <map>
+#include <queue>
 #include <vector>
 #include <set>
 #include <string>
 
 #include "definitions.hpp"
+#include "ULogIndex.hpp"
 
 #include <px4_platform_common/module.h>
 #include <uORB/topics/uORBTopics.hpp>
@@ -137,6 +140,7 @@ protected:
 
 		std::streampos next_read_pos;
 		uint64_t next_timestamp; ///< timestamp of the file
+		size_t next_index = 0; ///< index of next_read_pos in the ULogIndex data messages (if the index is used)
 
 		CompatBase *compat = nullptr;
 
@@ -207,6 +211,12 @@ protected:
 	 */
 	bool nextDataMessage(std::ifstream &file, Subscription &subscription, int msg_id);
 
+	/**
+	 * Same as nextDataMessage(), but using the file index instead of searching through the file.
+	 * @param skip_current if true, skip the message at next_index, otherwise read it
+	 */
+	bool nextIndexedDataMessage(Subscription &subscription, int msg_id, bool skip_current);
+
 	virtual uint64_t getTimestampOffset()
 	{
 		//we update the timestamps from the file by a constant offset to match
@@ -217,6 +227,8 @@ protected:
 	std::vector<Subscription *> _subscriptions;
 	std::vector<uint8_t> _read_buffer;
 
+	ULogIndex _index; ///< file index & memory-mapped file (only used if valid)
+
 	float _speed_factor{1.f}; ///< from PX4_SIM_SPEED_FACTOR env variable (set to 0 to avoid usleep = unlimited rate)
 
 private:
@@ -251,6 +263,29 @@ private:
 
 	float _accumulated_delay{0.f};
 
+	/** (next timestamp, msg_id) of all active subscriptions, ordered by timestamp (only used with the index) */
+	using QueueEntry = std::pair<uint64_t, uint16_t>;
+	std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry>> _publication_queue;
+
+	size_t _next_additional_message{0}; ///< index into ULogIndex::additionalMessages()
+
+	/**
+	 * Build the index of the data section of the replay file.
+	 * @return false if the index cannot be used (replay then falls back to reading the file sequentially)
+	 */
+	bool buildIndex();
+
+	/**
+	 * Get the subscription with the smallest next timestamp.
+	 * @return msg_id or -1 if there is no active subscription anymore
+	 */
+	int findNextSubscription(uint64_t &next_file_time);
+
+	/**
+	 * Add a subscription to the publication queue (only used with the index)
+	 */
+	void queueSubscription(int msg_id);
+
 	bool readFileHeader(std::ifstream &file);
 
 	/**
@@ -279,6 +314,7 @@ private:
 	 * @return false on file error
 	 */
 	bool readAndHandleAdditionalMessages(std::ifstream &file, std::streampos end_position);
+	bool readAndHandleAdditionalMessage(std::ifstream &file);
 	bool readDropout(std::ifstream &file, uint16_t msg_size);
 	bool readAndApplyParameter(std::ifstream &file, uint16_t msg_size);
 
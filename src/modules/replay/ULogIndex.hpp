@@ -0,0 +1,104 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+namespace px4
+{
+
+/**
+ * @class ULogIndex
+ * Memory-maps an ULog file and builds an index of the data section in a single pass:
+ * for each message id, the sorted list of file offsets of its data messages, plus the offsets
+ * of all subscription (ADD_LOGGED_MSG), parameter and dropout messages.
+ * This allows the replay to jump directly to the next message of a topic instead of
+ * seeking through the messages of all other topics.
+ */
+class ULogIndex
+{
+public:
+	ULogIndex() = default;
+	~ULogIndex();
+
+	ULogIndex(const ULogIndex &) = delete;
+	ULogIndex &operator=(const ULogIndex &) = delete;
+
+	/**
+	 * Map the file and index the data section.
+	 * @param file_name ULog file
+	 * @param data_section_start file offset of the first ADD_LOGGED_MSG message
+	 * @param read_until_file_position stop indexing at this offset (e.g. if the log contains appended data)
+	 * @return true on success, false if the file cannot be mapped (the index is unusable then)
+	 */
+	bool build(const char *file_name, uint64_t data_section_start, uint64_t read_until_file_position);
+
+	bool valid() const { return _data != nullptr; }
+
+	/** pointer to the start of the mapped file */
+	const uint8_t *data() const { return _data; }
+
+	uint64_t fileSize() const { return _file_size; }
+
+	/** offsets of all data messages for a message id, in file order */
+	const std::vector<uint64_t> &dataMessages(uint16_t msg_id) const
+	{
+		return msg_id < _data_messages.size() ? _data_messages[msg_id] : _empty;
+	}
+
+	/** offsets of all ADD_LOGGED_MSG messages, in file order */
+	const std::vector<uint64_t> &subscriptionMessages() const { return _subscription_messages; }
+
+	/** offsets of all PARAMETER and DROPOUT messages of the data section, in file order */
+	const std::vector<uint64_t> &additionalMessages() const { return _additional_messages; }
+
+	size_t numDataMessages() const { return _num_data_messages; }
+
+private:
+	void unmap();
+
+	uint8_t *_data{nullptr};
+	uint64_t _file_size{0};
+
+	std::vector<std::vector<uint64_t>> _data_messages; ///< indexed by message id
+	std::vector<uint64_t> _subscription_messages;
+	std::vector<uint64_t> _additional_messages;
+	size_t _num_data_messages{0};
+
+	const std::vector<uint64_t> _empty;
+};
+
+} //namespace px4
@@ -64,6 +64,8 @@ void DataValidator::put(uint64_t timestamp, const float val[dimensions], uint32_
 	_error_count = error_count_in;
 	_priority = priority_in;
 
+	const float event_count_inv = 1.f / _event_count;
+
 	for (unsigned i = 0; i < dimensions; i++) {
 		if (PX4_ISFINITE(val[i])) {
 			if (_time_last == 0) {
@@ -75,9 +77,8 @@ void DataValidator::put(uint64_t timestamp, const float val[dimensions], uint32_
 				float lp_val = val[i] - _lp[i];
 
 				float delta_val = lp_val - _mean[i];
-				_mean[i] += delta_val / _event_count;
+				_mean[i] += delta_val * event_count_inv;
 				_M2[i] += delta_val * (lp_val - _mean[i]);
-				_rms[i] = sqrtf(_M2[i] / (_event_count - 1));
 
 				if (fabsf(_value[i] - val[i]) < 0.000001f) {
 					_value_equal_count++;
@@ -97,6 +98,18 @@ void DataValidator::put(uint64_t timestamp, const float val[dimensions], uint32_
 	_time_last = timestamp;
 }
 
+float *DataValidator::rms()
+{
+	// only the sum of squares is tracked per sample, the RMS is computed on request
+	if (_event_count > 1) {
+		for (unsigned i = 0; i < dimensions; i++) {
+			_rms[i] = sqrtf(_M2[i] / (_event_count - 1));
+		}
+	}
+
+	return _rms;
+}
+
 float DataValidator::confidence(uint64_t timestamp)
 {
 
@@ -148,6 +161,8 @@ void DataValidator::print()
 		return;
 	}
 
+	rms();
+
 	for (unsigned i = 0; i < dimensions; i++) {
 		PX4_INFO_RAW("\tval: %8.4f, lp: %8.4f mean dev: %8.4f RMS: %8.4f conf: %8.4f\n", (double)_value[i],
 			     (double)_lp[i], (double)_mean[i], (double)_rms[i], (double)confidence(hrt_absolute_time()));
@@ -122,9 +122,9 @@ public:
 
 	/**
 	 * Get the RMS values of this validator
-	 * @return		the stored RMS
+	 * @return		the RMS, computed from the running sum of squares
 	 */
-	float *rms() { return _rms; }
+	float *rms();
 
 	/**
 	 * Print the validator value
@@ -164,25 +164,29 @@ public:
 	static constexpr uint32_t ERROR_FLAG_HIGH_ERRDENSITY = (0x00000001U << 4);
 
 private:
-	uint32_t _error_mask{ERROR_FLAG_NO_ERROR}; /**< sensor error state */
-
-	uint32_t _timeout_interval{40000}; /**< interval in which the datastream times out in us */
-
+	// per sample state, updated incrementally by put()
 	uint64_t _time_last{0};   /**< last timestamp */
 	uint64_t _event_count{0}; /**< total data counter */
 	uint32_t _error_count{0}; /**< error count */
 
 	int _error_density{0}; /**< ratio between successful reads and errors */
 
-	uint8_t _priority{0}; /**< sensor nominal priority */
+	unsigned _value_equal_count{0}; /**< equal values in a row */
 
 	float _mean[dimensions] {}; /**< mean of value */
 	float _lp[dimensions] {};   /**< low pass value */
 	float _M2[dimensions] {};   /**< RMS component value */
-	float _rms[dimensions] {};  /**< root mean square error */
 	float _value[dimensions] {}; /**< last value */
 
-	unsigned _value_equal_count{0}; /**< equal values in a row */
+	uint8_t _priority{0}; /**< sensor nominal priority */
+
+	// state only needed when voting or reporting
+	uint32_t _error_mask{ERROR_FLAG_NO_ERROR}; /**< sensor error state */
+
+	uint32_t _timeout_interval{40000}; /**< interval in which the datastream times out in us */
+
+	float _rms[dimensions] {};  /**< root mean square error */
+
 	unsigned _value_equal_count_threshold{
 		VALUE_EQUAL_COUNT_DEFAULT}; /**< when to consider an equal count as a problem */
 
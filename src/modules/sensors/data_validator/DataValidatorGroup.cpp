@@ -177,7 +177,9 @@ float *DataValidatorGroup::get_best(uint64_t timestamp, int *index)
 	next = _first;
 
 	while (next != nullptr) {
-		float confidence = next->confidence(timestamp);
+		// the confidence of the current selection was already evaluated above
+		const float confidence = (i == pre_check_best) ? pre_check_confidence : next->confidence(timestamp);
+		const int priority = next->priority();
 
 		/*
 		 * Switch if:
@@ -185,12 +187,12 @@ float *DataValidatorGroup::get_best(uint64_t timestamp, int *index)
 		 * 2) the confidence is less than 1% different and the priority is higher
 		 */
 		if ((((max_confidence < MIN_REGULAR_CONFIDENCE) && (confidence >= MIN_REGULAR_CONFIDENCE)) ||
-		     (confidence > max_confidence && (next->priority() >= max_priority)) ||
-		     (fabsf(confidence - max_confidence) < 0.01f && (next->priority() > max_priority))) &&
+		     (confidence > max_confidence && (priority >= max_priority)) ||
+		     (fabsf(confidence - max_confidence) < 0.01f && (priority > max_priority))) &&
 		    (confidence > 0.0f)) {
 			max_index = i;
 			max_confidence = confidence;
-			max_priority = next->priority();
+			max_priority = priority;
 			best = next;
 		}
 
@@ -95,6 +95,32 @@ void VehicleAirData::AirTemperatureUpdate()
 	}
 }
 
+void VehicleAirData::GroundEffectUpdate(const hrt_abstime &timestamp_sample)
+{
+	vehicle_land_detected_s vehicle_land_detected;
+
+	if (_vehicle_land_detected_sub.update(&vehicle_land_detected)) {
+		_in_ground_effect = vehicle_land_detected.in_ground_effect;
+	}
+
+	// rotor downwash increases the static pressure close to the ground, the barometer reads too low.
+	// Ramp the correction in and out to avoid altitude steps.
+	static constexpr float ground_effect_time_constant = 0.5f; // [s]
+
+	const float offset_target = _in_ground_effect ? _param_sens_baro_ge_off.get() : 0.f;
+
+	if ((_ground_effect_timestamp_last != 0) && (timestamp_sample > _ground_effect_timestamp_last)) {
+		const float dt = (timestamp_sample - _ground_effect_timestamp_last) * 1e-6f;
+		const float alpha = math::min(dt / ground_effect_time_constant, 1.f);
+		_ground_effect_offset += alpha * (offset_target - _ground_effect_offset);
+
+	} else {
+		_ground_effect_offset = offset_target;
+	}
+
+	_ground_effect_timestamp_last = timestamp_sample;
+}
+
 bool VehicleAirData::ParametersUpdate(bool force)
 {
 	// Check if parameters have changed
@@ -105,6 +131,13 @@ bool VehicleAirData::ParametersUpdate(bool force)
 
 		updateParams();
 
+		if (!_param_sens_baro_fuse.get() || !PX4_ISFINITE(_baro_qnh_last)
+		    || (fabsf(_param_sens_baro_qnh.get() - _baro_qnh_last) > FLT_EPSILON)) {
+			// all altitudes change with the sea level pressure, restart the fusion
+			_baro_fusion.reset();
+			_baro_qnh_last = _param_sens_baro_qnh.get();
+		}
+
 		// update priority
 		for (int instance = 0; instance < MAX_SENSOR_COUNT; instance++) {
 
@@ -195,10 +228,17 @@ void VehicleAirData::Run()
 					_calibration[uorb_index].SensorCorrectionsUpdate();
 					const float pressure_corrected = _calibration[uorb_index].Correct(report.pressure);
 					const float pressure_sealevel_pa = _param_sens_baro_qnh.get() * 100.f;
+					const float altitude = getAltitudeFromPressure(pressure_corrected, pressure_sealevel_pa);
 
-					float data_array[3] {pressure_corrected, report.temperature, getAltitudeFromPressure(pressure_corrected, pressure_sealevel_pa)};
+					float data_array[3] {pressure_corrected, report.temperature, altitude};
 					_voter.put(uorb_index, report.timestamp, data_array, report.error_count, _priority[uorb_index]);
 
+					// fuse all healthy barometers
+					if (_param_sens_baro_fuse.get() && (_priority[uorb_index] > 0)
+					    && (_voter.get_sensor_state(uorb_index) == DataValidator::ERROR_FLAG_NO_ERROR)) {
+						_baro_fusion.fuse(uorb_index, altitude, report.timestamp_sample);
+					}
+
 					_timestamp_sample_sum[uorb_index] += report.timestamp_sample;
 					_data_sum[uorb_index] += pressure_corrected;
 					_temperature_sum[uorb_index] += report.temperature;
@@ -231,6 +271,8 @@ void VehicleAirData::Run()
 
 			_selected_sensor_sub_index = best_index;
 			_sensor_sub[_selected_sensor_sub_index].registerCallback();
+
+			_baro_fusion.setReferenceInstance(_selected_sensor_sub_index);
 		}
 	}
 
@@ -257,8 +299,18 @@ void VehicleAirData::Run()
 						const float pressure_pa = _data_sum[instance] / _data_sum_count[instance];
 						const float temperature = _temperature_sum[instance] / _data_sum_count[instance];
 
-						const float pressure_sealevel_pa = _param_sens_baro_qnh.get() * 100.f;
-						const float altitude = getAltitudeFromPressure(pressure_pa, pressure_sealevel_pa);
+						float altitude = NAN;
+
+						if (_param_sens_baro_fuse.get() && _baro_fusion.initialized()) {
+							altitude = _baro_fusion.getAltitude(timestamp_sample);
+
+						} else {
+							const float pressure_sealevel_pa = _param_sens_baro_qnh.get() * 100.f;
+							altitude = getAltitudeFromPressure(pressure_pa, pressure_sealevel_pa);
+						}
+
+						GroundEffectUpdate(timestamp_sample);
+						altitude += _ground_effect_offset;
 
 						// calculate air density
 						const float air_density = getDensityFromPressureAndTemp(pressure_pa, temperature);
@@ -411,6 +463,22 @@ void VehicleAirData::PrintStatus()
 			_calibration[i].PrintStatus();
 		}
 	}
+
+	if (_param_sens_baro_fuse.get() && _baro_fusion.initialized()) {
+		PX4_INFO_RAW("[vehicle_air_data] fused altitude variance: %.4f m^2, velocity: %.2f m/s\n",
+			     (double)_baro_fusion.getAltitudeVariance(), (double)_baro_fusion.getVelocity());
+
+		for (int i = 0; i < MAX_SENSOR_COUNT; i++) {
+			if (_baro_fusion.offsetValid(i)) {
+				PX4_INFO_RAW("[vehicle_air_data] %d offset: %.3f m, noise: %.3f m\n", i,
+					     (double)_baro_fusion.getOffset(i), (double)sqrtf(_baro_fusion.getNoiseVariance(i)));
+			}
+		}
+	}
+
+	if (fabsf(_ground_effect_offset) > 0.f) {
+		PX4_INFO_RAW("[vehicle_air_data] ground effect offset: %.2f m\n", (double)_ground_effect_offset);
+	}
 }
 
 }; // namespace sensors
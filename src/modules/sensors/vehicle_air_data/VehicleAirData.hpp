@@ -33,6 +33,7 @@
 
 #pragma once
 
+#include "baro_fusion.hpp"
 #include "data_validator/DataValidatorGroup.hpp"
 
 #include <lib/sensor_calibration/Barometer.hpp>
@@ -54,6 +55,7 @@
 #include <uORB/topics/sensor_baro.h>
 #include <uORB/topics/sensors_status.h>
 #include <uORB/topics/vehicle_air_data.h>
+#include <uORB/topics/vehicle_land_detected.h>
 
 using namespace time_literals;
 
@@ -76,6 +78,7 @@ private:
 
 	void AirTemperatureUpdate();
 	void CheckFailover(const hrt_abstime &time_now_us);
+	void GroundEffectUpdate(const hrt_abstime &timestamp_sample);
 	bool ParametersUpdate(bool force = false);
 	void UpdateStatus();
 
@@ -88,6 +91,7 @@ private:
 	uORB::SubscriptionInterval _parameter_update_sub{ORB_ID(parameter_update), 1_s};
 
 	uORB::Subscription _differential_pressure_sub{ORB_ID(differential_pressure)};
+	uORB::Subscription _vehicle_land_detected_sub{ORB_ID(vehicle_land_detected)};
 
 	uORB::SubscriptionCallbackWorkItem _sensor_sub[MAX_SENSOR_COUNT] {
 		{this, ORB_ID(sensor_baro), 0},
@@ -123,9 +127,18 @@ private:
 
 	float _air_temperature_celsius{20.f}; // initialize with typical 20degC ambient temperature
 
+	BaroFusion _baro_fusion{};
+	float _baro_qnh_last{NAN};
+
+	bool _in_ground_effect{false};
+	float _ground_effect_offset{0.f}; ///< altitude correction while in ground effect [m], ramped
+	hrt_abstime _ground_effect_timestamp_last{0};
+
 	DEFINE_PARAMETERS(
 		(ParamFloat<px4::params::SENS_BARO_QNH>) _param_sens_baro_qnh,
-		(ParamFloat<px4::params::SENS_BARO_RATE>) _param_sens_baro_rate
+		(ParamFloat<px4::params::SENS_BARO_RATE>) _param_sens_baro_rate,
+		(ParamBool<px4::params::SENS_BARO_FUSE>) _param_sens_baro_fuse,
+		(ParamFloat<px4::params::SENS_BARO_GE_OFF>) _param_sens_baro_ge_off
 	)
 };
 }; // namespace sensors
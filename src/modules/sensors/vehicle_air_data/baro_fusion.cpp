@@ -0,0 +1,178 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file baro_fusion.cpp
+ */
+
+#include "baro_fusion.hpp"
+
+void BaroFusion::reset()
+{
+	_initialized = false;
+
+	for (int i = 0; i < MAX_SENSOR_COUNT; i++) {
+		_offset[i] = 0.f;
+		_noise_var[i] = NOISE_VAR_INIT;
+		_timestamp_last[i] = 0;
+		_rejected_count[i] = 0;
+		_offset_valid[i] = false;
+	}
+}
+
+void BaroFusion::initialize(int instance, float altitude, hrt_abstime timestamp_sample)
+{
+	_altitude = altitude - _offset[instance];
+	_velocity = 0.f;
+	_P00 = _noise_var[instance];
+	_P01 = 0.f;
+	_P11 = VELOCITY_VAR_INIT;
+	_time_us = timestamp_sample;
+
+	// the other offsets are relative to the previous altitude, learn them again
+	for (int i = 0; i < MAX_SENSOR_COUNT; i++) {
+		if (i != instance) {
+			_offset_valid[i] = false;
+		}
+
+		_rejected_count[i] = 0;
+	}
+
+	_offset_valid[instance] = true;
+	_timestamp_last[instance] = timestamp_sample;
+	_initialized = true;
+}
+
+void BaroFusion::predict(hrt_abstime timestamp_sample)
+{
+	if (timestamp_sample <= _time_us) {
+		// older sample of another barometer, fuse at the filter time
+		return;
+	}
+
+	const float dt = math::min((timestamp_sample - _time_us) * 1e-6f, 1.f);
+	_time_us = timestamp_sample;
+
+	// constant velocity model, white noise acceleration
+	const float q = ACCEL_NOISE * ACCEL_NOISE;
+	const float dt2 = dt * dt;
+
+	_altitude += _velocity * dt;
+
+	_P00 += dt * (2.f * _P01 + dt * _P11) + 0.25f * dt2 * dt2 * q;
+	_P01 += dt * _P11 + 0.5f * dt2 * dt * q;
+	_P11 += dt2 * q;
+}
+
+bool BaroFusion::fuse(int instance, float altitude, hrt_abstime timestamp_sample)
+{
+	if ((instance < 0) || (instance >= MAX_SENSOR_COUNT) || !PX4_ISFINITE(altitude)) {
+		return false;
+	}
+
+	if (_reference_instance < 0) {
+		_reference_instance = instance;
+	}
+
+	if (!_initialized) {
+		if (instance == _reference_instance) {
+			initialize(instance, altitude, timestamp_sample);
+			return true;
+		}
+
+		return false;
+	}
+
+	predict(timestamp_sample);
+
+	const float dt_instance = (_timestamp_last[instance] != 0 && timestamp_sample > _timestamp_last[instance]) ?
+				  (timestamp_sample - _timestamp_last[instance]) * 1e-6f : 0.f;
+	_timestamp_last[instance] = timestamp_sample;
+
+	if (!_offset_valid[instance]) {
+		// start fusing a new barometer relative to the current altitude
+		_offset[instance] = altitude - getAltitude(timestamp_sample);
+		_noise_var[instance] = NOISE_VAR_INIT;
+		_rejected_count[instance] = 0;
+		_offset_valid[instance] = true;
+		return false;
+	}
+
+	const float innovation = altitude - _offset[instance] - _altitude;
+	const float innovation_var = _P00 + _noise_var[instance];
+
+	if (innovation * innovation > INNOVATION_GATE * INNOVATION_GATE * innovation_var) {
+		if (_rejected_count[instance] < UINT8_MAX) {
+			_rejected_count[instance]++;
+		}
+
+		if (_rejected_count[instance] > REJECTED_RESET) {
+			if (instance == _reference_instance) {
+				// the reference moved, follow it
+				initialize(instance, altitude, timestamp_sample);
+
+			} else {
+				// learn the offset of this barometer again
+				_offset_valid[instance] = false;
+			}
+		}
+
+		return false;
+	}
+
+	_rejected_count[instance] = 0;
+
+	// measurement noise from the innovations: E[innovation^2] = P00 + R
+	_noise_var[instance] = math::constrain(_noise_var[instance] + NOISE_VAR_ALPHA * (innovation * innovation - _P00 -
+					       _noise_var[instance]), NOISE_VAR_MIN, NOISE_VAR_MAX);
+
+	// Kalman update
+	const float K0 = _P00 / innovation_var;
+	const float K1 = _P01 / innovation_var;
+
+	_altitude += K0 * innovation;
+	_velocity += K1 * innovation;
+
+	_P11 -= K1 * _P01;
+	_P01 -= K0 * _P01;
+	_P00 -= K0 * _P00;
+
+	// track the offsets of all but the reference barometer
+	if (instance != _reference_instance) {
+		const float alpha = math::min(dt_instance / OFFSET_TIME_CONSTANT, 1.f);
+		_offset[instance] += alpha * (altitude - _altitude - _offset[instance]);
+	}
+
+	return true;
+}
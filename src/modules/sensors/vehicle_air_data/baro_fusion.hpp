@@ -0,0 +1,129 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file baro_fusion.hpp
+ *
+ * Fusion of the altitudes of multiple barometers with a constant vertical velocity Kalman filter.
+ *
+ * The offset of every barometer relative to the fused altitude is tracked with a long time constant, except
+ * for the reference (selected) barometer, whose offset is held. The fused altitude therefore follows the
+ * reference barometer at low frequencies, while the noise of all healthy barometers is averaged, weighted by
+ * their measurement noise, which is estimated online from the innovations.
+ */
+
+#pragma once
+
+#include <drivers/drv_hrt.h>
+#include <lib/mathlib/mathlib.h>
+
+using namespace time_literals;
+
+class BaroFusion
+{
+public:
+	static constexpr int MAX_SENSOR_COUNT = 4;
+
+	BaroFusion() = default;
+	~BaroFusion() = default;
+
+	void reset();
+
+	/**
+	 * The reference barometer defines the fused altitude, its offset is not updated.
+	 * Changing the reference keeps all offsets, the fused altitude does not jump.
+	 */
+	void setReferenceInstance(int instance) { _reference_instance = instance; }
+
+	/**
+	 * Fuse an altitude sample of a healthy barometer.
+	 *
+	 * @param instance		Barometer instance.
+	 * @param altitude		Barometer altitude [m].
+	 * @param timestamp_sample	Sample time [us].
+	 * @return			true if the sample was fused.
+	 */
+	bool fuse(int instance, float altitude, hrt_abstime timestamp_sample);
+
+	bool initialized() const { return _initialized; }
+
+	/**
+	 * Fused altitude, propagated to the requested time with the estimated vertical velocity.
+	 */
+	float getAltitude(hrt_abstime timestamp_sample) const
+	{
+		const float dt = (timestamp_sample >= _time_us) ? (timestamp_sample - _time_us) * 1e-6f
+				 : -((_time_us - timestamp_sample) * 1e-6f);
+		return _altitude + _velocity * dt;
+	}
+
+	float getVelocity() const { return _velocity; }
+	float getAltitudeVariance() const { return _P00; }
+
+	float getOffset(int instance) const { return _offset[instance]; }
+	float getNoiseVariance(int instance) const { return _noise_var[instance]; }
+	bool offsetValid(int instance) const { return _offset_valid[instance]; }
+
+private:
+	static constexpr float NOISE_VAR_INIT = 0.25f;   ///< initial barometer noise variance [m^2]
+	static constexpr float NOISE_VAR_MIN = 0.0025f;
+	static constexpr float NOISE_VAR_MAX = 25.f;
+	static constexpr float NOISE_VAR_ALPHA = 0.01f;  ///< per sample low-pass gain of the noise estimate
+	static constexpr float VELOCITY_VAR_INIT = 1.f;  ///< [(m/s)^2]
+	static constexpr float ACCEL_NOISE = 2.f;        ///< vertical acceleration process noise [m/s^2]
+	static constexpr float OFFSET_TIME_CONSTANT = 10.f; ///< [s]
+	static constexpr float INNOVATION_GATE = 5.f;    ///< [SD]
+	static constexpr uint8_t REJECTED_RESET = 10;    ///< consecutive rejected reference samples before a reset
+
+	void initialize(int instance, float altitude, hrt_abstime timestamp_sample);
+	void predict(hrt_abstime timestamp_sample);
+
+	// states and covariance
+	float _altitude{0.f};
+	float _velocity{0.f};
+	float _P00{0.f};
+	float _P01{0.f};
+	float _P11{0.f};
+
+	hrt_abstime _time_us{0};
+
+	float _offset[MAX_SENSOR_COUNT] {};
+	float _noise_var[MAX_SENSOR_COUNT] {NOISE_VAR_INIT, NOISE_VAR_INIT, NOISE_VAR_INIT, NOISE_VAR_INIT};
+	hrt_abstime _timestamp_last[MAX_SENSOR_COUNT] {};
+	uint8_t _rejected_count[MAX_SENSOR_COUNT] {};
+	bool _offset_valid[MAX_SENSOR_COUNT] {};
+
+	int _reference_instance{-1};
+	bool _initialized{false};
+};
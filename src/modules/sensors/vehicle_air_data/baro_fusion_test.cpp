@@ -0,0 +1,189 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * Test code for the barometer fusion
+ * Run this test only using make tests TESTFILTER=baro_fusion
+ */
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "baro_fusion.hpp"
+
+class BaroFusionTest : public ::testing::Test
+{
+public:
+	struct Baro {
+		float offset;
+		float noise_std;
+		hrt_abstime interval_us;
+		hrt_abstime phase_us;
+	};
+
+	static float trueAltitude(hrt_abstime t)
+	{
+		// climb and hover
+		const float t_s = t * 1e-6f;
+		return 100.f + 10.f * sinf(0.1f * t_s) + 2.f * t_s / (1.f + 0.05f * t_s);
+	}
+
+	// run the barometers for duration, returns the RMS error of the fused and of the reference barometer altitude
+	void run(BaroFusion &fusion, const Baro baros[], int baro_count, hrt_abstime duration, float &rms_fused,
+		 float &rms_reference, float step_instance_2 = 0.f)
+	{
+		std::mt19937 gen(1);
+		std::normal_distribution<float> noise(0.f, 1.f);
+
+		float error_fused_sum = 0.f;
+		float error_reference_sum = 0.f;
+		int count = 0;
+
+		for (hrt_abstime t = 1000; t < duration; t += 1000) {
+			for (int i = 0; i < baro_count; i++) {
+				if ((t % baros[i].interval_us) == baros[i].phase_us) {
+					float altitude = trueAltitude(t) + baros[i].offset + baros[i].noise_std * noise(gen);
+
+					if ((i == 2) && (t > duration / 2)) {
+						altitude += step_instance_2;
+					}
+
+					fusion.fuse(i, altitude, t);
+
+					// evaluate after the initial convergence, at the reference rate
+					if ((i == 0) && (t > 20_s)) {
+						const float error_fused = fusion.getAltitude(t) - trueAltitude(t);
+						const float error_reference = altitude - trueAltitude(t);
+						error_fused_sum += error_fused * error_fused;
+						error_reference_sum += error_reference * error_reference;
+						count++;
+					}
+				}
+			}
+		}
+
+		rms_fused = sqrtf(error_fused_sum / count);
+		rms_reference = sqrtf(error_reference_sum / count);
+	}
+};
+
+TEST_F(BaroFusionTest, singleBaro)
+{
+	BaroFusion fusion;
+	const Baro baros[] {{0.f, 0.3f, 20_ms, 0}};
+
+	float rms_fused = 0.f;
+	float rms_reference = 0.f;
+	run(fusion, baros, 1, 60_s, rms_fused, rms_reference);
+
+	EXPECT_TRUE(fusion.initialized());
+	EXPECT_LT(rms_fused, rms_reference);
+	EXPECT_NEAR(fusion.getNoiseVariance(0), 0.3f * 0.3f, 0.05f);
+}
+
+TEST_F(BaroFusionTest, threeBaros)
+{
+	BaroFusion fusion;
+	fusion.setReferenceInstance(0);
+
+	const Baro baros[] {
+		{0.f, 0.3f, 20_ms, 0},
+		{3.f, 0.5f, 40_ms, 7_ms},
+		{-2.f, 0.2f, 20_ms, 13_ms},
+	};
+
+	BaroFusion fusion_single;
+	float rms_single = 0.f;
+	float rms_reference = 0.f;
+	run(fusion_single, baros, 1, 120_s, rms_single, rms_reference);
+
+	float rms_fused = 0.f;
+	run(fusion, baros, 3, 120_s, rms_fused, rms_reference);
+
+	// the fused altitude is less noisy than the reference barometer alone, filtered the same way
+	EXPECT_LT(rms_fused, 0.75f * rms_single) << "altitude RMS error: reference baro " << rms_reference
+			<< " m, filtered reference " << rms_single << " m, 3 baros fused " << rms_fused << " m";
+
+	// offsets relative to the reference
+	EXPECT_NEAR(fusion.getOffset(1), 3.f, 0.3f);
+	EXPECT_NEAR(fusion.getOffset(2), -2.f, 0.3f);
+
+	// lowest noise gets the highest weight
+	EXPECT_LT(fusion.getNoiseVariance(2), fusion.getNoiseVariance(0));
+	EXPECT_LT(fusion.getNoiseVariance(0), fusion.getNoiseVariance(1));
+}
+
+TEST_F(BaroFusionTest, referenceChange)
+{
+	BaroFusion fusion;
+	fusion.setReferenceInstance(0);
+
+	const Baro baros[] {
+		{0.f, 0.1f, 20_ms, 0},
+		{5.f, 0.1f, 20_ms, 10_ms},
+	};
+
+	float rms_fused = 0.f;
+	float rms_reference = 0.f;
+	run(fusion, baros, 2, 60_s, rms_fused, rms_reference);
+
+	const hrt_abstime t = 60_s;
+	const float altitude_before = fusion.getAltitude(t);
+
+	// switching the reference keeps the altitude
+	fusion.setReferenceInstance(1);
+	fusion.fuse(1, trueAltitude(t) + 5.f, t);
+	EXPECT_NEAR(fusion.getAltitude(t), altitude_before, 0.2f);
+	EXPECT_NEAR(fusion.getOffset(1), 5.f, 0.2f);
+}
+
+TEST_F(BaroFusionTest, faultyBaroRejected)
+{
+	BaroFusion fusion;
+	fusion.setReferenceInstance(0);
+
+	// third barometer jumps by 30 m in the middle of the run
+	const Baro baros[] {
+		{0.f, 0.3f, 20_ms, 0},
+		{3.f, 0.3f, 20_ms, 7_ms},
+		{-2.f, 0.3f, 20_ms, 13_ms},
+	};
+
+	float rms_fused = 0.f;
+	float rms_reference = 0.f;
+	run(fusion, baros, 3, 120_s, rms_fused, rms_reference, 30.f);
+
+	EXPECT_LT(rms_fused, rms_reference);
+}
@@ -53,3 +53,37 @@ PARAM_DEFINE_FLOAT(SENS_BARO_QNH, 1013.25f);
  * @unit Hz
  */
 PARAM_DEFINE_FLOAT(SENS_BARO_RATE, 20.0f);
+
+/**
+ * Fuse all healthy barometers.
+ *
+ * If enabled, the published barometric altitude is the output of a Kalman filter
+ * fusing the altitudes of all healthy barometers, weighted by their estimated noise.
+ * The offsets between the barometers are learned, the fused altitude follows the
+ * selected barometer at low frequencies. If disabled, only the selected barometer is used.
+ *
+ * Note that EKF2 filters the fused altitude a second time and treats its error as white
+ * noise with the standard deviation EKF2_BARO_NOISE, while the error of the fused altitude
+ * is time correlated. EKF2_BARO_NOISE should not be reduced when enabling this.
+ *
+ * @boolean
+ * @group Sensors
+ */
+PARAM_DEFINE_INT32(SENS_BARO_FUSE, 0);
+
+/**
+ * Baro ground effect altitude correction.
+ *
+ * Altitude added to the barometric altitude while the land detector reports that the vehicle
+ * might be in ground effect, to compensate the pressure rise caused by the rotor downwash.
+ * Set to 0 to disable. The EKF2 ground effect dead zone (EKF2_GND_EFF_DZ) handles the same
+ * effect in the estimator, use only one of them.
+ *
+ * @min 0
+ * @max 5
+ * @decimal 2
+ * @increment 0.05
+ * @group Sensors
+ * @unit m
+ */
+PARAM_DEFINE_FLOAT(SENS_BARO_GE_OFF, 0.f);
@@ -54,6 +54,8 @@ VehicleAngularVelocity::~VehicleAngularVelocity()
 	Stop();
 
 	perf_free(_cycle_perf);
+	perf_free(_driver_latency_perf);
+	perf_free(_publish_latency_perf);
 	perf_free(_filter_reset_perf);
 	perf_free(_selection_changed_perf);
 
@@ -196,6 +198,8 @@ void VehicleAngularVelocity::ResetFilters(const hrt_abstime &time_now_us)
 		UpdateDynamicNotchEscRpm(time_now_us, true);
 		UpdateDynamicNotchFFT(time_now_us, true);
 
+		_notch_filter_bank_update = true;
+
 		_angular_velocity_raw_prev = angular_velocity_uncalibrated;
 
 		_reset_filters = false;
@@ -449,6 +453,7 @@ void VehicleAngularVelocity::ParametersUpdate(bool force)
 			if (_dynamic_notch_filter_esc_rpm == nullptr) {
 
 				_dynamic_notch_filter_esc_rpm = new NotchFilterHarmonic[esc_rpm_harmonics];
+				_notch_filter_bank_update = true;
 
 				if (_dynamic_notch_filter_esc_rpm) {
 					_esc_rpm_harmonics = esc_rpm_harmonics;
@@ -543,6 +548,8 @@ void VehicleAngularVelocity::DisableDynamicNotchEscRpm()
 				}
 			}
 		}
+
+		_notch_filter_bank_update = true;
 	}
 
 #endif // !CONSTRAINED_FLASH
@@ -561,6 +568,7 @@ void VehicleAngularVelocity::DisableDynamicNotchFFT()
 		}
 
 		_dynamic_notch_fft_available = false;
+		_notch_filter_bank_update = true;
 	}
 
 #endif // !CONSTRAINED_FLASH
@@ -573,6 +581,8 @@ void VehicleAngularVelocity::UpdateDynamicNotchEscRpm(const hrt_abstime &time_no
 
 	if (enabled && (_esc_status_sub.updated() || force)) {
 
+		_notch_filter_bank_update = true;
+
 		bool axis_init[3] {false, false, false};
 
 		esc_status_s esc_status;
@@ -670,6 +680,8 @@ void VehicleAngularVelocity::UpdateDynamicNotchFFT(const hrt_abstime &time_now_u
 
 	if (enabled && (_sensor_gyro_fft_sub.updated() || force)) {
 
+		_notch_filter_bank_update = true;
+
 		if (!_dynamic_notch_fft_available) {
 			// force update filters if previously disabled
 			force = true;
@@ -722,60 +734,107 @@ void VehicleAngularVelocity::UpdateDynamicNotchFFT(const hrt_abstime &time_now_u
 #endif // !CONSTRAINED_FLASH
 }
 
-float VehicleAngularVelocity::FilterAngularVelocity(int axis, float data[], int N)
+void VehicleAngularVelocity::UpdateFilterBank()
 {
+	int num_sections = 2; // notch filter 0 & 1
+
+#if !defined(CONSTRAINED_FLASH)
+	num_sections += MAX_NUM_FFT_PEAKS;
+
+	if (_dynamic_notch_filter_esc_rpm) {
+		num_sections += _esc_rpm_harmonics * MAX_NUM_ESCS;
+	}
+
+#endif // !CONSTRAINED_FLASH
+
+	if ((_notch_filter_bank.size() != num_sections) && !_notch_filter_bank.allocate(num_sections)) {
+		// retry on the next update
+		return;
+	}
+
+	int section = 0;
+
 #if !defined(CONSTRAINED_FLASH)
 
-	// Apply dynamic notch filter from ESC RPM
+	// dynamic notch filter from ESC RPM
 	if (_dynamic_notch_filter_esc_rpm) {
 		for (int esc = 0; esc < MAX_NUM_ESCS; esc++) {
-			if (_esc_available[esc]) {
-				for (int harmonic = 0; harmonic < _esc_rpm_harmonics; harmonic++) {
-					if (_dynamic_notch_filter_esc_rpm[harmonic][axis][esc].getNotchFreq() > 0.f) {
-						_dynamic_notch_filter_esc_rpm[harmonic][axis][esc].applyArray(data, N);
-					}
+			for (int harmonic = 0; harmonic < _esc_rpm_harmonics; harmonic++) {
+				for (int axis = 0; axis < 3; axis++) {
+					UpdateFilterBankSection(section, axis, _dynamic_notch_filter_esc_rpm[harmonic][axis][esc]);
 				}
+
+				section++;
 			}
 		}
 	}
 
-	// Apply dynamic notch filter from FFT
-	if (_dynamic_notch_fft_available) {
-		for (int peak = MAX_NUM_FFT_PEAKS - 1; peak >= 0; peak--) {
-			if (_dynamic_notch_filter_fft[axis][peak].getNotchFreq() > 0.f) {
-				_dynamic_notch_filter_fft[axis][peak].applyArray(data, N);
-			}
+	// dynamic notch filter from FFT
+	for (int peak = MAX_NUM_FFT_PEAKS - 1; peak >= 0; peak--) {
+		for (int axis = 0; axis < 3; axis++) {
+			UpdateFilterBankSection(section, axis, _dynamic_notch_filter_fft[axis][peak]);
 		}
+
+		section++;
 	}
 
 #endif // !CONSTRAINED_FLASH
 
-	// Apply general notch filter 0 (IMU_GYRO_NF0_FRQ)
-	if (_notch_filter0_velocity[axis].getNotchFreq() > 0.f) {
-		_notch_filter0_velocity[axis].applyArray(data, N);
+	// general notch filter 0 (IMU_GYRO_NF0_FRQ) and 1 (IMU_GYRO_NF1_FRQ)
+	for (int axis = 0; axis < 3; axis++) {
+		UpdateFilterBankSection(section, axis, _notch_filter0_velocity[axis]);
+		UpdateFilterBankSection(section + 1, axis, _notch_filter1_velocity[axis]);
 	}
 
-	// Apply general notch filter 1 (IMU_GYRO_NF1_FRQ)
-	if (_notch_filter1_velocity[axis].getNotchFreq() > 0.f) {
-		_notch_filter1_velocity[axis].applyArray(data, N);
+	_notch_filter_bank_update = false;
+}
+
+void VehicleAngularVelocity::UpdateFilterBankSection(int section, int axis, math::NotchFilter<float> &nf)
+{
+	if (nf.getNotchFreq() > 0.f) {
+		float a[3];
+		float b[3];
+		nf.getCoefficients(a, b);
+
+		// the bank initializes the filter state from the next sample, mark the notch filter as initialized
+		const bool reset = !nf.initialized();
+		_notch_filter_bank.setCoefficients(section, axis, a, b, reset);
+
+		if (reset) {
+			nf.reset(0.f);
+		}
+
+	} else {
+		_notch_filter_bank.disable(section, axis);
 	}
+}
+
+Vector3f VehicleAngularVelocity::FilterAngularVelocity(float data[][math::BiquadFilterBank::CHANNELS], int N)
+{
+	// Apply all notch filters (ESC RPM, FFT, IMU_GYRO_NF0_FRQ, IMU_GYRO_NF1_FRQ) to all axes in one pass
+	_notch_filter_bank.apply(data, N);
 
 	// Apply general low-pass filter (IMU_GYRO_CUTOFF)
-	_lp_filter_velocity[axis].applyArray(data, N);
+	for (int axis = 0; axis < 3; axis++) {
+		for (int n = 0; n < N; n++) {
+			data[n][axis] = _lp_filter_velocity[axis].apply(data[n][axis]);
+		}
+	}
 
 	// return last filtered sample
-	return data[N - 1];
+	return Vector3f{data[N - 1][0], data[N - 1][1], data[N - 1][2]};
 }
 
-float VehicleAngularVelocity::FilterAngularAcceleration(int axis, float inverse_dt_s, float data[], int N)
+float VehicleAngularVelocity::FilterAngularAcceleration(int axis, float inverse_dt_s,
+		const float data[][math::BiquadFilterBank::CHANNELS], int N)
 {
 	// angular acceleration: Differentiate & apply specific angular acceleration (D-term) low-pass (IMU_DGYRO_CUTOFF)
 	float angular_acceleration_filtered = 0.f;
 
 	for (int n = 0; n < N; n++) {
-		const float angular_acceleration = (data[n] - _angular_velocity_raw_prev(axis)) * inverse_dt_s;
+		const float angular_acceleration = (data[n][axis] - _angular_velocity_raw_prev(axis)) * inverse_dt_s;
 		angular_acceleration_filtered = _lp_filter_acceleration[axis].update(angular_acceleration);
-		_angular_velocity_raw_prev(axis) = data[n];
+		_angular_velocity_raw_prev(axis) = data[n][axis];
 	}
 
 	return angular_acceleration_filtered;
@@ -820,6 +879,10 @@ void VehicleAngularVelocity::Run()
 	UpdateDynamicNotchEscRpm(time_now_us);
 	UpdateDynamicNotchFFT(time_now_us);
 
+	if (_notch_filter_bank_update) {
+		UpdateFilterBank();
+	}
+
 	if (_fifo_available) {
 		// process all outstanding fifo messages
 		int sensor_sub_updates = 0;
@@ -830,29 +893,29 @@ void VehicleAngularVelocity::Run()
 
 			const float inverse_dt_s = 1e6f / sensor_fifo_data.dt;
 			const int N = sensor_fifo_data.samples;
-			static constexpr int FIFO_SIZE_MAX = sizeof(sensor_fifo_data.x) / sizeof(sensor_fifo_data.x[0]);
 
 			if ((sensor_fifo_data.dt > 0) && (N > 0) && (N <= FIFO_SIZE_MAX)) {
-				Vector3f angular_velocity_uncalibrated;
-				Vector3f angular_acceleration_uncalibrated;
+				// copy raw int16 sensor samples to interleaved float array for filtering
+				for (int n = 0; n < N; n++) {
+					_filter_data[n][0] = sensor_fifo_data.scale * sensor_fifo_data.x[n];
+					_filter_data[n][1] = sensor_fifo_data.scale * sensor_fifo_data.y[n];
+					_filter_data[n][2] = sensor_fifo_data.scale * sensor_fifo_data.z[n];
+				}
 
-				int16_t *raw_data_array[] {sensor_fifo_data.x, sensor_fifo_data.y, sensor_fifo_data.z};
+				// save last filtered sample
+				const Vector3f angular_velocity_uncalibrated{FilterAngularVelocity(_filter_data, N)};
+				Vector3f angular_acceleration_uncalibrated;
 
 				for (int axis = 0; axis < 3; axis++) {
-					// copy raw int16 sensor samples to float array for filtering
-					float data[FIFO_SIZE_MAX];
-
-					for (int n = 0; n < N; n++) {
-						data[n] = sensor_fifo_data.scale * raw_data_array[axis][n];
-					}
-
-					// save last filtered sample
-					angular_velocity_uncalibrated(axis) = FilterAngularVelocity(axis, data, N);
-					angular_acceleration_uncalibrated(axis) = FilterAngularAcceleration(axis, inverse_dt_s, data, N);
+					angular_acceleration_uncalibrated(axis) = FilterAngularAcceleration(axis, inverse_dt_s, _filter_data, N);
 				}
 
 				// Publish
 				if (!_sensor_gyro_fifo_sub.updated()) {
+					if (sensor_fifo_data.timestamp >= sensor_fifo_data.timestamp_sample) {
+						perf_set_elapsed(_driver_latency_perf, sensor_fifo_data.timestamp - sensor_fifo_data.timestamp_sample);
+					}
+
 					if (CalibrateAndPublish(sensor_fifo_data.timestamp_sample,
 								angular_velocity_uncalibrated,
 								angular_acceleration_uncalibrated)) {
@@ -882,22 +945,25 @@ void VehicleAngularVelocity::Run()
 							   0.00002f, 0.02f);
 				_timestamp_sample_last = sensor_data.timestamp_sample;
 
-				Vector3f angular_velocity_uncalibrated;
-				Vector3f angular_acceleration_uncalibrated;
+				// copy sensor sample to float array for filtering
+				_filter_data[0][0] = sensor_data.x;
+				_filter_data[0][1] = sensor_data.y;
+				_filter_data[0][2] = sensor_data.z;
 
-				float raw_data_array[] {sensor_data.x, sensor_data.y, sensor_data.z};
+				// save last filtered sample
+				const Vector3f angular_velocity_uncalibrated{FilterAngularVelocity(_filter_data)};
+				Vector3f angular_acceleration_uncalibrated;
 
 				for (int axis = 0; axis < 3; axis++) {
-					// copy sensor sample to float array for filtering
-					float data[1] {raw_data_array[axis]};
-
-					// save last filtered sample
-					angular_velocity_uncalibrated(axis) = FilterAngularVelocity(axis, data);
-					angular_acceleration_uncalibrated(axis) = FilterAngularAcceleration(axis, inverse_dt_s, data);
+					angular_acceleration_uncalibrated(axis) = FilterAngularAcceleration(axis, inverse_dt_s, _filter_data);
 				}
 
 				// Publish
 				if (!_sensor_sub.updated()) {
+					if (sensor_data.timestamp >= sensor_data.timestamp_sample) {
+						perf_set_elapsed(_driver_latency_perf, sensor_data.timestamp - sensor_data.timestamp_sample);
+					}
+
 					if (CalibrateAndPublish(sensor_data.timestamp_sample,
 								angular_velocity_uncalibrated,
 								angular_acceleration_uncalibrated)) {
@@ -939,6 +1005,11 @@ bool VehicleAngularVelocity::CalibrateAndPublish(const hrt_abstime &timestamp_sa
 		angular_velocity.timestamp = hrt_absolute_time();
 		_vehicle_angular_velocity_pub.publish(angular_velocity);
 
+		// latency from the (newest) gyro sample to the vehicle_angular_velocity publication
+		if (angular_velocity.timestamp >= timestamp_sample) {
+			perf_set_elapsed(_publish_latency_perf, angular_velocity.timestamp - timestamp_sample);
+		}
+
 		// shift last publish time forward, but don't let it get further behind than the interval
 		_last_publish = math::constrain(_last_publish + _publish_interval_min_us,
 						timestamp_sample - _publish_interval_min_us, timestamp_sample);
@@ -959,6 +1030,8 @@ void VehicleAngularVelocity::PrintStatus()
 	_calibration.PrintStatus();
 
 	perf_print_counter(_cycle_perf);
+	perf_print_counter(_driver_latency_perf);
+	perf_print_counter(_publish_latency_perf);
 	perf_print_counter(_filter_reset_perf);
 	perf_print_counter(_selection_changed_perf);
 #if !defined(CONSTRAINED_FLASH)
@@ -38,6 +38,7 @@
 #include <lib/mathlib/math/Limits.hpp>
 #include <lib/matrix/matrix/math.hpp>
 #include <lib/mathlib/math/filter/AlphaFilter.hpp>
+#include <lib/mathlib/math/filter/BiquadFilterBank.hpp>
 #include <lib/mathlib/math/filter/LowPassFilter2p.hpp>
 #include <lib/mathlib/math/filter/NotchFilter.hpp>
 #include <px4_platform_common/log.h>
@@ -78,8 +79,9 @@ private:
 	bool CalibrateAndPublish(const hrt_abstime &timestamp_sample, const matrix::Vector3f &angular_velocity_uncalibrated,
 				 const matrix::Vector3f &angular_acceleration_uncalibrated);
 
-	inline float FilterAngularVelocity(int axis, float data[], int N = 1);
-	inline float FilterAngularAcceleration(int axis, float inverse_dt_s, float data[], int N = 1);
+	inline matrix::Vector3f FilterAngularVelocity(float data[][math::BiquadFilterBank::CHANNELS], int N = 1);
+	inline float FilterAngularAcceleration(int axis, float inverse_dt_s, const float data[][math::BiquadFilterBank::CHANNELS],
+					       int N = 1);
 
 	void DisableDynamicNotchEscRpm();
 	void DisableDynamicNotchFFT();
@@ -92,6 +94,9 @@ private:
 	void UpdateDynamicNotchFFT(const hrt_abstime &time_now_us, bool force = false);
 	bool UpdateSampleRate();
 
+	void UpdateFilterBank();
+	void UpdateFilterBankSection(int section, int axis, math::NotchFilter<float> &nf);
+
 	// scaled appropriately for current sensor
 	matrix::Vector3f GetResetAngularVelocity() const;
 	matrix::Vector3f GetResetAngularAcceleration() const;
@@ -168,6 +173,16 @@ private:
 	bool _dynamic_notch_fft_available{false};
 #endif // !CONSTRAINED_FLASH
 
+	// All notch filters of the three axes run as one bank of biquad sections, in the same order as they are listed
+	// here: ESC RPM harmonics, FFT peaks, notch 0 and notch 1. The NotchFilter objects above only hold the
+	// parameters, the bank holds the filter state.
+	math::BiquadFilterBank _notch_filter_bank{};
+	bool _notch_filter_bank_update{true};
+
+	// interleaved (x, y, z, unused) samples of the current batch
+	static constexpr int FIFO_SIZE_MAX = sizeof(sensor_gyro_fifo_s::x) / sizeof(sensor_gyro_fifo_s::x[0]);
+	float _filter_data[FIFO_SIZE_MAX][math::BiquadFilterBank::CHANNELS] {};
+
 	// angular acceleration filter
 	AlphaFilter<float> _lp_filter_acceleration[3] {};
 
@@ -178,6 +193,8 @@ private:
 	bool _update_sample_rate{true};
 
 	perf_counter_t _cycle_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": gyro filter")};
+	perf_counter_t _driver_latency_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": gyro sample to driver publish")};
+	perf_counter_t _publish_latency_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": gyro sample to angular velocity publish")};
 	perf_counter_t _filter_reset_perf{perf_alloc(PC_COUNT, MODULE_NAME": gyro filter reset")};
 	perf_counter_t _selection_changed_perf{perf_alloc(PC_COUNT, MODULE_NAME": gyro selection changed")};
 
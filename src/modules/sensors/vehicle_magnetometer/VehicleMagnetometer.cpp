@@ -415,6 +415,84 @@ void VehicleMagnetometer::UpdatePowerCompensation()
 	}
 }
 
+void VehicleMagnetometer::UpdateInterferenceCompensation(const hrt_abstime &time_now_us)
+{
+	if (_magnetometer_interference_estimate_sub.updated()) {
+		magnetometer_interference_estimate_s mag_interference_est;
+
+		if (_magnetometer_interference_estimate_sub.copy(&mag_interference_est)) {
+			for (int mag_index = 0; mag_index < MAX_SENSOR_COUNT; mag_index++) {
+				MagInterference &interference = _mag_interference[mag_index];
+
+				if (interference.device_id != mag_interference_est.device_id[mag_index]) {
+					interference = MagInterference{};
+					interference.device_id = mag_interference_est.device_id[mag_index];
+				}
+
+				interference.valid = mag_interference_est.valid[mag_index];
+
+				// keep the last valid coefficients while the compensation is ramped out
+				if (interference.valid) {
+					interference.current = Vector3f{mag_interference_est.current_x[mag_index],
+									mag_interference_est.current_y[mag_index],
+									mag_interference_est.current_z[mag_index]};
+					interference.throttle = Vector3f{mag_interference_est.throttle_x[mag_index],
+									 mag_interference_est.throttle_y[mag_index],
+									 mag_interference_est.throttle_z[mag_index]};
+				}
+			}
+		}
+	}
+
+	// ramp the compensation in and out to avoid heading steps when the estimate becomes (in)valid
+	static constexpr float interference_ramp_time = 1.f; // [s]
+
+	float weight_step = 1.f;
+
+	if ((_interference_timestamp_last != 0) && (time_now_us > _interference_timestamp_last)) {
+		weight_step = (time_now_us - _interference_timestamp_last) * 1e-6f / interference_ramp_time;
+	}
+
+	_interference_timestamp_last = time_now_us;
+
+	bool interference_applied = false;
+
+	// the online estimate replaces the static CAL_MAGx_COMP compensation, never apply both
+	for (int mag_index = 0; mag_index < MAX_SENSOR_COUNT; mag_index++) {
+		MagInterference &interference = _mag_interference[mag_index];
+
+		if ((_mag_comp_type == MagCompensationType::Disabled)
+		    && (interference.device_id != 0) && (interference.device_id == _calibration[mag_index].device_id())) {
+
+			interference.weight = math::constrain(interference.weight + (interference.valid ? weight_step : -weight_step), 0.f, 1.f);
+
+		} else {
+			interference.weight = 0.f;
+		}
+
+		if (interference.weight > 0.f) {
+			interference_applied = true;
+		}
+	}
+
+	// only poll the inputs while there is an estimate to apply
+	if (interference_applied) {
+		_interference_inputs.update();
+	}
+
+	for (int mag_index = 0; mag_index < MAX_SENSOR_COUNT; mag_index++) {
+		const MagInterference &interference = _mag_interference[mag_index];
+
+		if (interference.weight > 0.f) {
+			_interference_compensation[mag_index] = (interference.current * _interference_inputs.current()
+								 + interference.throttle * _interference_inputs.throttle()) * interference.weight;
+
+		} else {
+			_interference_compensation[mag_index].zero();
+		}
+	}
+}
+
 void VehicleMagnetometer::Run()
 {
 	perf_begin(_cycle_perf);
@@ -437,6 +515,7 @@ void VehicleMagnetometer::Run()
 	}
 
 	UpdatePowerCompensation();
+	UpdateInterferenceCompensation(time_now_us);
 
 	UpdateMagBiasEstimate();
 
@@ -489,7 +568,8 @@ void VehicleMagnetometer::Run()
 						ParametersUpdate(true);
 					}
 
-					const Vector3f vect{_calibration[uorb_index].Correct(Vector3f{report.x, report.y, report.z}) - _calibration_estimator_bias[uorb_index]};
+					const Vector3f vect{_calibration[uorb_index].Correct(Vector3f{report.x, report.y, report.z})
+							    - _calibration_estimator_bias[uorb_index] - _interference_compensation[uorb_index]};
 
 					float mag_array[3] {vect(0), vect(1), vect(2)};
 					_voter.put(uorb_index, report.timestamp, mag_array, report.error_count, _priority[uorb_index]);
@@ -37,6 +37,7 @@
 
 #include <lib/sensor_calibration/Magnetometer.hpp>
 #include <lib/conversion/rotation.h>
+#include <lib/field_sensor_interference_estimator/FieldSensorInterferenceInputs.hpp>
 #include <lib/mathlib/math/Limits.hpp>
 #include <lib/matrix/matrix/math.hpp>
 #include <lib/perf/perf_counter.h>
@@ -53,6 +54,7 @@
 #include <uORB/topics/battery_status.h>
 #include <uORB/topics/estimator_sensor_bias.h>
 #include <uORB/topics/magnetometer_bias_estimate.h>
+#include <uORB/topics/magnetometer_interference_estimate.h>
 #include <uORB/topics/parameter_update.h>
 #include <uORB/topics/sensor_mag.h>
 #include <uORB/topics/sensor_preflight_mag.h>
@@ -94,6 +96,7 @@ private:
 	void UpdateMagBiasEstimate();
 	void UpdateMagCalibration();
 	void UpdatePowerCompensation();
+	void UpdateInterferenceCompensation(const hrt_abstime &time_now_us);
 
 	static constexpr int MAX_SENSOR_COUNT = 4;
 
@@ -113,6 +116,7 @@ private:
 	uORB::Subscription _vehicle_thrust_setpoint_0_sub{ORB_ID(vehicle_thrust_setpoint), 0};
 	uORB::Subscription _battery_status_sub{ORB_ID(battery_status), 0};
 	uORB::Subscription _magnetometer_bias_estimate_sub{ORB_ID(magnetometer_bias_estimate)};
+	uORB::Subscription _magnetometer_interference_estimate_sub{ORB_ID(magnetometer_interference_estimate)};
 	uORB::Subscription _vehicle_control_mode_sub{ORB_ID(vehicle_control_mode)};
 
 	// Used to check, save and use learned magnetometer biases
@@ -149,6 +153,21 @@ private:
 
 	MagCompensationType _mag_comp_type{MagCompensationType::Disabled};
 
+	// Online magnetometer interference compensation (mag_interference_estimator), body frame
+	struct MagInterference {
+		uint32_t device_id{0};
+		matrix::Vector3f current{};  ///< [Gauss/kA]
+		matrix::Vector3f throttle{}; ///< [Gauss]
+		bool valid{false};
+		float weight{0.f}; ///< applied fraction of the compensation, ramped
+	} _mag_interference[MAX_SENSOR_COUNT] {};
+
+	hrt_abstime _interference_timestamp_last{0};
+
+	FieldSensorInterferenceInputs _interference_inputs{};
+
+	matrix::Vector3f _interference_compensation[MAX_SENSOR_COUNT] {};
+
 	perf_counter_t _cycle_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": cycle")};
 
 	hrt_abstime _last_error_message{0};
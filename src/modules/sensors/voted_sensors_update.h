@@ -172,6 +172,9 @@ private:
 	uint32_t _accel_device_id[MAX_SENSOR_COUNT] {};	/**< accel driver device id for each uorb instance */
 	uint32_t _gyro_device_id[MAX_SENSOR_COUNT] {};	/**< gyro driver device id for each uorb instance */
 
+	uint32_t _accel_error_count[MAX_SENSOR_COUNT] {};	/**< accel error count from vehicle_imu_status for each uorb instance */
+	uint32_t _gyro_error_count[MAX_SENSOR_COUNT] {};	/**< gyro error count from vehicle_imu_status for each uorb instance */
+
 	uint64_t _last_accel_timestamp[MAX_SENSOR_COUNT] {};	/**< latest full timestamp */
 
 	sensor_selection_s _selection {};		/**< struct containing the sensor selection to be published to the uORB */
@@ -297,6 +297,7 @@ int TemperatureCompensation::parameters_update()
 	 */
 	_gyro_data.reset_temperature();
 	_accel_data.reset_temperature();
+	_mag_data.reset_temperature();
 	_baro_data.reset_temperature();
 
 	return ret;
@@ -358,12 +359,9 @@ bool TemperatureCompensation::calc_thermal_offsets_3D(const SensorCalData3D &coe
 
 	}
 
-	// calulate the offsets
-	float delta_temp_2 = delta_temp * delta_temp;
-	float delta_temp_3 = delta_temp_2 * delta_temp;
-
+	// calulate the offsets (Horner's method)
 	for (uint8_t i = 0; i < 3; i++) {
-		offset[i] = coef.x0[i] + coef.x1[i] * delta_temp + coef.x2[i] * delta_temp_2 + coef.x3[i] * delta_temp_3;
+		offset[i] = coef.x0[i] + delta_temp * (coef.x1[i] + delta_temp * (coef.x2[i] + delta_temp * coef.x3[i]));
 	}
 
 	return ret;
@@ -433,11 +431,9 @@ int TemperatureCompensation::update_offsets_accel(int topic_instance, float temp
 		return -1;
 	}
 
-	// Calculate and update the offsets
-	calc_thermal_offsets_3D(_parameters.accel_cal_data[mapping], temperature, offsets);
-
-	// Check if temperature delta is large enough to warrant a new publication
+	// Only re-evaluate the offsets if the temperature delta is large enough to warrant a new publication
 	if (fabsf(temperature - _accel_data.last_temperature[topic_instance]) > 1.0f) {
+		calc_thermal_offsets_3D(_parameters.accel_cal_data[mapping], temperature, offsets);
 		_accel_data.last_temperature[topic_instance] = temperature;
 		return 2;
 	}
@@ -459,11 +455,9 @@ int TemperatureCompensation::update_offsets_gyro(int topic_instance, float tempe
 		return -1;
 	}
 
-	// Calculate and update the offsets
-	calc_thermal_offsets_3D(_parameters.gyro_cal_data[mapping], temperature, offsets);
-
-	// Check if temperature delta is large enough to warrant a new publication
+	// Only re-evaluate the offsets if the temperature delta is large enough to warrant a new publication
 	if (fabsf(temperature - _gyro_data.last_temperature[topic_instance]) > 1.0f) {
+		calc_thermal_offsets_3D(_parameters.gyro_cal_data[mapping], temperature, offsets);
 		_gyro_data.last_temperature[topic_instance] = temperature;
 		return 2;
 	}
@@ -485,11 +479,9 @@ int TemperatureCompensation::update_offsets_mag(int topic_instance, float temper
 		return -1;
 	}
 
-	// Calculate and update the offsets
-	calc_thermal_offsets_3D(_parameters.mag_cal_data[mapping], temperature, offsets);
-
-	// Check if temperature delta is large enough to warrant a new publication
+	// Only re-evaluate the offsets if the temperature delta is large enough to warrant a new publication
 	if (fabsf(temperature - _mag_data.last_temperature[topic_instance]) > 1.0f) {
+		calc_thermal_offsets_3D(_parameters.mag_cal_data[mapping], temperature, offsets);
 		_mag_data.last_temperature[topic_instance] = temperature;
 		return 2;
 	}
@@ -511,11 +503,9 @@ int TemperatureCompensation::update_offsets_baro(int topic_instance, float tempe
 		return -1;
 	}
 
-	// Calculate and update the offsets
-	calc_thermal_offsets_1D(_parameters.baro_cal_data[mapping], temperature, *offsets);
-
-	// Check if temperature delta is large enough to warrant a new publication
+	// Only re-evaluate the offsets if the temperature delta is large enough to warrant a new publication
 	if (fabsf(temperature - _baro_data.last_temperature[topic_instance]) > 1.0f) {
+		calc_thermal_offsets_1D(_parameters.baro_cal_data[mapping], temperature, *offsets);
 		_baro_data.last_temperature[topic_instance] = temperature;
 		return 2;
 	}
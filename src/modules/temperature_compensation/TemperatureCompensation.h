@@ -86,7 +86,8 @@ public:
 	 * @param topic_instance uORB topic instance
 	 * @param sensor_data input sensor data, output sensor data with applied corrections
 	 * @param temperature measured current temperature
-	 * @param offsets returns offsets that were applied (length = 3, except for baro), depending on return value
+	 * @param offsets returns offsets that were applied (length = 3, except for baro), depending on return value.
+	 *                The offsets are only re-evaluated once the temperature changed by more than 1 deg C.
 	 * @return -1: error: correction enabled, but no sensor mapping set (@see set_sendor_id_gyro)
 	 *         0: no changes (correction not enabled),
 	 *         1: corrections applied but no changes to offsets,
@@ -42,9 +42,11 @@
 __BEGIN_DECLS
 
 extern int test_microbench_atomic(int argc, char *argv[]);
+extern int test_microbench_filter(int argc, char *argv[]);
 extern int test_microbench_hrt(int argc, char *argv[]);
 extern int test_microbench_math(int argc, char *argv[]);
 extern int test_microbench_matrix(int argc, char *argv[]);
+extern int test_microbench_sensors(int argc, char *argv[]);
 extern int test_microbench_uorb(int argc, char *argv[]);
 
 __END_DECLS
@@ -64,9 +66,11 @@ const struct {
 	{"all",		microbench_all,		OPT_NOALLTEST},
 
 	{"microbench_atomic",	test_microbench_atomic,	0},
+	{"microbench_filter",	test_microbench_filter,	0},
 	{"microbench_hrt",	test_microbench_hrt,	0},
 	{"microbench_math",	test_microbench_math,	0},
 	{"microbench_matrix",	test_microbench_matrix,	0},
+	{"microbench_sensors",	test_microbench_sensors,	0},
 	{"microbench_uorb",	test_microbench_uorb,	0},
 
 	{"null",			nullptr, 		0}
@@ -0,0 +1,181 @@
+/****************************************************************************
+ *
+ *  Copyright (C) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file test_microbench_filter.cpp
+ * Microbenchmarks of the gyro notch filtering: NotchFilter chain vs. BiquadFilterBank.
+ */
+
+#include <unit_test.h>
+
+#include <drivers/drv_hrt.h>
+#include <perf/perf_counter.h>
+#include <px4_platform_common/px4_config.h>
+#include <px4_platform_common/micro_hal.h>
+
+#include <lib/mathlib/math/filter/BiquadFilterBank.hpp>
+#include <lib/mathlib/math/filter/NotchFilter.hpp>
+
+namespace MicroBenchFilter
+{
+
+#ifdef __PX4_NUTTX
+#include <nuttx/irq.h>
+static irqstate_t flags;
+#endif
+
+void lock()
+{
+#ifdef __PX4_NUTTX
+	flags = px4_enter_critical_section();
+#endif
+}
+
+void unlock()
+{
+#ifdef __PX4_NUTTX
+	px4_leave_critical_section(flags);
+#endif
+}
+
+#define PERF(name, op, count) do { \
+		px4_usleep(1000); \
+		reset(); \
+		perf_counter_t p = perf_alloc(PC_ELAPSED, name); \
+		for (int i = 0; i < count; i++) { \
+			px4_usleep(1); \
+			lock(); \
+			perf_begin(p); \
+			op; \
+			perf_end(p); \
+			unlock(); \
+			reset(); \
+		} \
+		perf_print_counter(p); \
+		perf_free(p); \
+	} while (0)
+
+class MicroBenchFilter : public UnitTest
+{
+public:
+	virtual bool run_tests();
+
+private:
+	// 8 ESCs with 3 harmonics, 3 FFT peaks and 2 static notches, as configured on an octocopter
+	static constexpr int NUM_SECTIONS = 8 * 3 + 3 + 2;
+	static constexpr int FIFO_SIZE = 32;
+	static constexpr float SAMPLE_FREQ = 8000.f;
+
+	bool init();
+	bool time_notch_filter_chain();
+	bool time_biquad_filter_bank();
+
+	void reset();
+	void applyChain();
+
+	math::NotchFilter<float> _notch[3][NUM_SECTIONS] {};
+	math::BiquadFilterBank _bank{};
+
+	float _chain[3][FIFO_SIZE] {};
+	float _interleaved[FIFO_SIZE][math::BiquadFilterBank::CHANNELS] {};
+};
+
+bool MicroBenchFilter::run_tests()
+{
+	ut_run_test(init);
+	ut_run_test(time_notch_filter_chain);
+	ut_run_test(time_biquad_filter_bank);
+
+	return (_tests_failed == 0);
+}
+
+bool MicroBenchFilter::init()
+{
+	if (!_bank.allocate(NUM_SECTIONS)) {
+		return false;
+	}
+
+	for (int section = 0; section < NUM_SECTIONS; section++) {
+		for (int axis = 0; axis < 3; axis++) {
+			// spread the notches between 50 Hz and 1 kHz, slightly different per axis
+			math::NotchFilter<float> &nf = _notch[axis][section];
+			nf.setParameters(SAMPLE_FREQ, 50.f + 33.f * section + 2.f * axis, 20.f);
+
+			float a[3];
+			float b[3];
+			nf.getCoefficients(a, b);
+			_bank.setCoefficients(section, axis, a, b, false);
+		}
+	}
+
+	return true;
+}
+
+void MicroBenchFilter::reset()
+{
+	for (int n = 0; n < FIFO_SIZE; n++) {
+		const float t = n / SAMPLE_FREQ;
+
+		for (int axis = 0; axis < 3; axis++) {
+			const float x = 0.1f * axis + sinf(2.f * M_PI_F * 83.f * t) + 0.5f * sinf(2.f * M_PI_F * (400.f + 10.f * axis) * t);
+			_chain[axis][n] = x;
+			_interleaved[n][axis] = x;
+		}
+	}
+}
+
+void MicroBenchFilter::applyChain()
+{
+	// every notch filter doing its own pass over the batch of each axis
+	for (int axis = 0; axis < 3; axis++) {
+		for (int section = 0; section < NUM_SECTIONS; section++) {
+			_notch[axis][section].applyArray(_chain[axis], FIFO_SIZE);
+		}
+	}
+}
+
+bool MicroBenchFilter::time_notch_filter_chain()
+{
+	PERF("NotchFilter chain 29 sections x 3 axes x 32 samples", applyChain(), 100);
+	return true;
+}
+
+bool MicroBenchFilter::time_biquad_filter_bank()
+{
+	PERF("BiquadFilterBank 29 sections x 3 axes x 32 samples", _bank.apply(_interleaved, FIFO_SIZE), 100);
+	return true;
+}
+
+ut_declare_test_c(test_microbench_filter, MicroBenchFilter)
+
+} // namespace MicroBenchFilter
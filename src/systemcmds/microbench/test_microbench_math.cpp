@@ -44,6 +44,8 @@
 #include <math.h>
 
 #include <drivers/drv_hrt.h>
+#include <geo/geo.h>
+#include <lib/atmosphere/atmosphere.h>
 #include <perf/perf_counter.h>
 #include <px4_platform_common/px4_config.h>
 #include <px4_platform_common/micro_hal.h>
@@ -114,6 +116,8 @@ private:
 	bool time_32bit_integers();
 	bool time_64bit_integers();
 
+	bool time_altitude_from_pressure();
+
 	void reset();
 
 	volatile float f32;
@@ -148,6 +152,7 @@ bool MicroBenchMath::run_tests()
 	ut_run_test(time_16bit_integers);
 	ut_run_test(time_32bit_integers);
 	ut_run_test(time_64bit_integers);
+	ut_run_test(time_altitude_from_pressure);
 
 	return (_tests_failed == 0);
 }
@@ -277,4 +282,18 @@ bool MicroBenchMath::time_64bit_integers()
 	return true;
 }
 
+bool MicroBenchMath::time_altitude_from_pressure()
+{
+	using namespace atmosphere;
+
+	// baro pressure around 500 m
+	const float exponent = -(kTempGradient * kAirGasConstant) / CONSTANTS_ONE_G;
+
+	PERF("altitude powf (1k ops)", f32_out = ((powf((95000.f + f32) / kPressRefSeaLevelPa, exponent) * kTempRefKelvin)
+			- kTempRefKelvin) / kTempGradient, 1000);
+	PERF("altitude lookup (1k ops)", f32_out = getAltitudeFromPressure(95000.f + f32, kPressRefSeaLevelPa), 1000);
+
+	return true;
+}
+
 } // namespace MicroBenchMath
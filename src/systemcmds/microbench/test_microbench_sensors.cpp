@@ -0,0 +1,191 @@
+/****************************************************************************
+ *
+ *  Copyright (C) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file test_microbench_sensors.cpp
+ * Microbenchmarks of the sensors module voting: DataValidatorGroup put() and get_best().
+ */
+
+#include <unit_test.h>
+
+#include <drivers/drv_hrt.h>
+#include <perf/perf_counter.h>
+#include <px4_platform_common/px4_config.h>
+#include <px4_platform_common/micro_hal.h>
+
+#include <modules/sensors/data_validator/DataValidatorGroup.hpp>
+
+namespace MicroBenchSensors
+{
+
+#ifdef __PX4_NUTTX
+#include <nuttx/irq.h>
+static irqstate_t flags;
+#endif
+
+void lock()
+{
+#ifdef __PX4_NUTTX
+	flags = px4_enter_critical_section();
+#endif
+}
+
+void unlock()
+{
+#ifdef __PX4_NUTTX
+	px4_leave_critical_section(flags);
+#endif
+}
+
+#define PERF(name, op, count) do { \
+		px4_usleep(1000); \
+		reset(); \
+		perf_counter_t p = perf_alloc(PC_ELAPSED, name); \
+		for (int i = 0; i < count; i++) { \
+			px4_usleep(1); \
+			lock(); \
+			perf_begin(p); \
+			op; \
+			perf_end(p); \
+			unlock(); \
+		} \
+		perf_print_counter(p); \
+		perf_free(p); \
+	} while (0)
+
+class MicroBenchSensors : public UnitTest
+{
+public:
+	virtual bool run_tests();
+
+private:
+	// redundant sensors of a typical flight controller with an external GNSS/mag module
+	static constexpr int NUM_ACCEL = 3;
+	static constexpr int NUM_GYRO = 3;
+	static constexpr int NUM_MAG = 4;
+	static constexpr int NUM_BARO = 2;
+
+	bool init();
+	bool time_sensor_voting();
+
+	void reset();
+	void vote(DataValidatorGroup &voter, int instances, float scale);
+	void voteAll();
+
+	DataValidatorGroup _accel{NUM_ACCEL};
+	DataValidatorGroup _gyro{NUM_GYRO};
+	DataValidatorGroup _mag{NUM_MAG};
+	DataValidatorGroup _baro{NUM_BARO};
+
+	uint64_t _timestamp{0};
+	uint32_t _noise{0};
+};
+
+bool MicroBenchSensors::run_tests()
+{
+	ut_run_test(init);
+	ut_run_test(time_sensor_voting);
+
+	return (_tests_failed == 0);
+}
+
+bool MicroBenchSensors::init()
+{
+	// the groups are created with one validator, add the others as the sensors module does
+	for (int i = 1; i < NUM_MAG; i++) {
+		if ((i < NUM_ACCEL) && (!_accel.add_new_validator() || !_gyro.add_new_validator())) {
+			return false;
+		}
+
+		if (!_mag.add_new_validator()) {
+			return false;
+		}
+
+		if ((i < NUM_BARO) && !_baro.add_new_validator()) {
+			return false;
+		}
+	}
+
+	_accel.set_timeout(500000);
+	_gyro.set_timeout(500000);
+	_mag.set_timeout(300000);
+	_mag.set_equal_value_threshold(1000);
+	_baro.set_timeout(300000);
+
+	return true;
+}
+
+void MicroBenchSensors::reset()
+{
+	_timestamp = 1;
+	_noise = 1;
+}
+
+void MicroBenchSensors::vote(DataValidatorGroup &voter, int instances, float scale)
+{
+	for (int instance = 0; instance < instances; instance++) {
+		float val[3];
+
+		for (int axis = 0; axis < 3; axis++) {
+			// cheap pseudo random noise so that no sensor is flagged stale
+			_noise = _noise * 1664525u + 1013904223u;
+			val[axis] = scale * (1.f + 0.1f * axis) + 1e-3f * scale * static_cast<float>(_noise >> 16) / 65536.f;
+		}
+
+		voter.put(instance, _timestamp, val, 0, 100);
+	}
+
+	int best_index = -1;
+	voter.get_best(_timestamp, &best_index);
+}
+
+void MicroBenchSensors::voteAll()
+{
+	_timestamp += 1000;
+	vote(_accel, NUM_ACCEL, 9.81f);
+	vote(_gyro, NUM_GYRO, 0.1f);
+	vote(_mag, NUM_MAG, 0.4f);
+	vote(_baro, NUM_BARO, 100000.f);
+}
+
+bool MicroBenchSensors::time_sensor_voting()
+{
+	// one new sample of every sensor followed by a vote in each group, 12 samples in total
+	PERF("DataValidatorGroup 3 accel, 3 gyro, 4 mag, 2 baro", voteAll(), 1000);
+	return true;
+}
+
+ut_declare_test_c(test_microbench_sensors, MicroBenchSensors)
+
+} // namespace MicroBenchSensors